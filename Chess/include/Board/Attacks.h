@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include "Board/Bitboard.h"
+#include "Board/Square.h"
+
+
+// Squares attacked by a sliding piece on the given square, where the rays stop at
+// (and include) the first occupied square in each direction
+Bitboard rookAttacks(Square square, Bitboard occupied);
+Bitboard bishopAttacks(Square square, Bitboard occupied);
+Bitboard queenAttacks(Square square, Bitboard occupied);
+
+
+/**
+ * Builds the attack table of a piece that jumps by fixed row/column steps.
+ *
+ * @param steps The row/column offsets the piece can jump by.
+ * @return For each square, the squares reachable in one step.
+ */
+template <std::size_t N>
+constexpr std::array<Bitboard, 64> buildStepAttacks(const int (&steps)[N][2]) {
+
+	std::array<Bitboard, 64> table{};
+	for (int square = 0; square < 64; ++square) {
+		for (const auto& step : steps) {
+			int row = squareRow(static_cast<Square>(square)) + step[0];
+			int col = squareCol(static_cast<Square>(square)) + step[1];
+			if (isOnBoard(row, col)) {
+				table[square] |= squareMask(makeSquare(row, col));
+			}
+		}
+	}
+	return table;
+}
+
+
+/**
+ * Builds the squares a pawn attacks (one square diagonally forward) for one color.
+ * White pawns move toward higher rows, black pawns toward lower rows.
+ *
+ * @param isBlack The color of the pawn.
+ * @return For each square, the squares a pawn there attacks.
+ */
+constexpr std::array<Bitboard, 64> buildPawnAttacks(bool isBlack) {
+
+	int forward = isBlack ? -1 : 1;
+	const int steps[2][2] = { { forward, -1 }, { forward, 1 } };
+	return buildStepAttacks(steps);
+}
+
+
+/**
+ * Builds the squares a pawn can push to (one square forward, or two from its
+ * starting row) for one color, before checking that the squares are empty.
+ *
+ * @param isBlack The color of the pawn.
+ * @return For each square, the squares a pawn there can push to.
+ */
+constexpr std::array<Bitboard, 64> buildPawnPushes(bool isBlack) {
+
+	int forward = isBlack ? -1 : 1;
+	int startingRow = isBlack ? 6 : 1;
+
+	std::array<Bitboard, 64> table{};
+	for (int square = 0; square < 64; ++square) {
+		int row = squareRow(static_cast<Square>(square));
+		int col = squareCol(static_cast<Square>(square));
+		if (isOnBoard(row + forward, col)) {
+			table[square] |= squareMask(makeSquare(row + forward, col));
+		}
+		if (row == startingRow) {
+			table[square] |= squareMask(makeSquare(row + 2 * forward, col));
+		}
+	}
+	return table;
+}
+
+
+const int KNIGHT_STEPS[8][2] = { { 2, 1 }, { 2, -1 }, { -2, 1 }, { -2, -1 }, { 1, 2 }, { 1, -2 }, { -1, 2 }, { -1, -2 } };
+const int KING_STEPS[8][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 }, { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+// Attack and push tables of the non-sliding pieces, all built at compile time
+inline constexpr std::array<Bitboard, 64> KNIGHT_ATTACKS = buildStepAttacks(KNIGHT_STEPS);
+inline constexpr std::array<Bitboard, 64> KING_ATTACKS = buildStepAttacks(KING_STEPS);
+inline constexpr std::array<std::array<Bitboard, 64>, 2> PAWN_ATTACKS = { buildPawnAttacks(false), buildPawnAttacks(true) };	// [isBlack][square]
+inline constexpr std::array<std::array<Bitboard, 64>, 2> PAWN_PUSHES = { buildPawnPushes(false), buildPawnPushes(true) };		// [isBlack][square]
@@ -0,0 +1,55 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+
+
+// A set of board squares, one bit per square (bit index = row * 8 + col)
+using Bitboard = std::uint64_t;
+
+
+/**
+ * Returns a bitboard with only the given square set.
+ *
+ * @param index The square index (0-63).
+ * @return A bitboard containing the single square.
+ */
+constexpr Bitboard squareMask(int index) {
+	return Bitboard{ 1 } << index;
+}
+
+
+/**
+ * Returns the index of the lowest set square.
+ * The bitboard must not be empty.
+ *
+ * @param bitboard The set of squares.
+ * @return The index of the lowest set square.
+ */
+constexpr int lowestSquare(Bitboard bitboard) {
+	return std::countr_zero(bitboard);
+}
+
+
+/**
+ * Removes the lowest set square from the bitboard and returns its index.
+ * The bitboard must not be empty.
+ *
+ * @param bitboard The set of squares, updated in place.
+ * @return The index of the removed square.
+ */
+constexpr int popLowestSquare(Bitboard& bitboard) {
+	int index = std::countr_zero(bitboard);
+	bitboard &= bitboard - 1;
+	return index;
+}
+
+
+/**
+ * Counts the squares in a bitboard.
+ *
+ * @param bitboard The set of squares.
+ * @return The number of set squares.
+ */
+constexpr int countSquares(Bitboard bitboard) {
+	return std::popcount(bitboard);
+}
@@ -1,26 +1,63 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
-#include <memory>
-#include "Factory/PieceFactory.h"
+#include <array>
+#include <span>
+#include <type_traits>
+#include "Board/Bitboard.h"
+#include "Board/Square.h"
+#include "Board/UndoRecord.h"
+#include "Pieces/PieceCode.h"
 
+
+// A position held entirely by value: copying a board is a plain memory copy
+// and never touches the allocator.
 class Board
 {
 public:
 	Board(const std::string& boardString);
-	Board(const Board& other);
 
-	Piece* getPieceAt(const std::string& position) const;
-	Piece* removePieceAt(const std::string& position);
-	void placePiece(Piece* piece, const std::string& position);
-	void movePiece(Piece* from, const std::string& to);
-	std::string findKingPosition(bool isBlack) const;
-	const std::unordered_map<std::string, std::unique_ptr<Piece>>& getBoard() const;
+	PieceCode getPieceAt(Square position) const;
+	PieceCode removePieceAt(Square position);
+	void placePiece(PieceCode piece, Square position);
+	UndoRecord makeMove(Square from, Square to);
+	void unmakeMove(UndoRecord& undo);
+	void makeNullMove();
+	void unmakeNullMove();
+	Square findKingPosition(bool isBlack) const;
+	std::span<const Square> getPieceList(bool isBlack) const;
+
+	Bitboard getPieces(PieceType type, bool isBlack) const;
+	Bitboard getOccupancy(bool isBlack) const;
+	Bitboard getOccupancy() const;
+	std::uint64_t getHash() const;
+	bool isBlackTurn() const;
+	void setBlackTurn(bool isBlackTurn);
+	int getMaterial(bool isBlack) const;
+	int getPhase() const;
+	int getEvaluation() const;
 
 private:
-	std::unordered_map<std::string, std::unique_ptr<Piece>> m_board;
+	std::array<PieceCode, 64> m_squares;									// Piece per square index, NO_PIECE if empty
+	std::array<std::array<Bitboard, PIECE_TYPE_COUNT>, 2> m_pieceMasks{};	// [isBlack][type] -> squares
+	std::array<Bitboard, 2> m_colorMasks{};									// [isBlack] -> squares
+	Bitboard m_occupied = 0;												// All occupied squares
+	std::uint64_t m_hash = 0;												// Zobrist key of the position
+	bool m_isBlackTurn = false;												// Side to move, part of the key
+	std::array<Square, 2> m_kingSquares{ NO_SQUARE, NO_SQUARE };			// [isBlack] -> king square
+	std::array<std::array<Square, 64>, 2> m_pieceLists{};					// [isBlack] -> occupied squares, unordered
+	std::array<std::uint8_t, 2> m_pieceCounts{};							// [isBlack] -> length of the piece list
+	std::array<std::uint8_t, 64> m_listIndex{};								// Square -> slot in its color's piece list
+	std::array<int, 2> m_material{};										// [isBlack] -> value of the pieces
+	std::array<int, 2> m_middlegameScores{};								// [isBlack] -> middlegame piece-square sum
+	std::array<int, 2> m_endgameScores{};									// [isBlack] -> endgame piece-square sum
+	int m_phase = 0;														// Weighted count of knights, bishops, rooks and queens
+
+	void addToIndexes(PieceCode piece, Square square);
+	void removeFromIndexes(PieceCode piece, Square square);
+	void moveInIndexes(PieceCode piece, Square from, Square to);
+	void updateKingSquare(bool isBlack);
+	void addToScores(PieceCode piece, Square square, int sign);
+};
 
-	std::string indexToPosition(int index) const;
-	std::string charToPieceName(char symbol) const;
-};
\ No newline at end of file
+static_assert(std::is_trivially_copyable_v<Board>, "Board copies must not allocate");
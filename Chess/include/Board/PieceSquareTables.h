@@ -0,0 +1,124 @@
+#pragma once
+#include <array>
+#include "Board/Square.h"
+#include "Pieces/PieceType.h"
+
+
+// Piece values and static evaluation terms, in centipawns. The tables are laid out by
+// square index, white's back row first, and score a white piece; black pieces read them mirrored.
+using PieceSquareTable = std::array<int, 64>;
+
+inline constexpr std::array<int, PIECE_TYPE_COUNT> PIECE_VALUES = { 100, 320, 330, 500, 900, 20000 };	// [type], a king outweighs everything else
+inline constexpr std::array<int, PIECE_TYPE_COUNT> PHASE_WEIGHTS = { 0, 1, 1, 2, 4, 0 };			// [type] -> share in the game phase
+inline constexpr int MAX_PHASE = 24;	// Phase with all pieces on the board; 0 is a pawn endgame
+
+inline constexpr PieceSquareTable PAWN_MIDDLEGAME = {
+	  0,   0,   0,   0,   0,   0,   0,   0,
+	  5,  10,  10, -20, -20,  10,  10,   5,
+	  5,  -5, -10,   0,   0, -10,  -5,   5,
+	  0,   0,   0,  20,  20,   0,   0,   0,
+	  5,   5,  10,  25,  25,  10,   5,   5,
+	 10,  10,  20,  30,  30,  20,  10,  10,
+	 50,  50,  50,  50,  50,  50,  50,  50,
+	  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+inline constexpr PieceSquareTable PAWN_ENDGAME = {
+	  0,   0,   0,   0,   0,   0,   0,   0,
+	 10,  10,  10,  10,  10,  10,  10,  10,
+	 10,  10,  10,  10,  10,  10,  10,  10,
+	 20,  20,  20,  20,  20,  20,  20,  20,
+	 30,  30,  30,  30,  30,  30,  30,  30,
+	 50,  50,  50,  50,  50,  50,  50,  50,
+	 80,  80,  80,  80,  80,  80,  80,  80,
+	  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+inline constexpr PieceSquareTable KNIGHT_TABLE = {
+	-50, -40, -30, -30, -30, -30, -40, -50,
+	-40, -20,   0,   5,   5,   0, -20, -40,
+	-30,   5,  10,  15,  15,  10,   5, -30,
+	-30,   0,  15,  20,  20,  15,   0, -30,
+	-30,   5,  15,  20,  20,  15,   5, -30,
+	-30,   0,  10,  15,  15,  10,   0, -30,
+	-40, -20,   0,   0,   0,   0, -20, -40,
+	-50, -40, -30, -30, -30, -30, -40, -50
+};
+
+inline constexpr PieceSquareTable BISHOP_TABLE = {
+	-20, -10, -10, -10, -10, -10, -10, -20,
+	-10,   5,   0,   0,   0,   0,   5, -10,
+	-10,  10,  10,  10,  10,  10,  10, -10,
+	-10,   0,  10,  10,  10,  10,   0, -10,
+	-10,   5,   5,  10,  10,   5,   5, -10,
+	-10,   0,   5,  10,  10,   5,   0, -10,
+	-10,   0,   0,   0,   0,   0,   0, -10,
+	-20, -10, -10, -10, -10, -10, -10, -20
+};
+
+inline constexpr PieceSquareTable ROOK_TABLE = {
+	  0,   0,   0,   5,   5,   0,   0,   0,
+	 -5,   0,   0,   0,   0,   0,   0,  -5,
+	 -5,   0,   0,   0,   0,   0,   0,  -5,
+	 -5,   0,   0,   0,   0,   0,   0,  -5,
+	 -5,   0,   0,   0,   0,   0,   0,  -5,
+	 -5,   0,   0,   0,   0,   0,   0,  -5,
+	  5,  10,  10,  10,  10,  10,  10,   5,
+	  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+inline constexpr PieceSquareTable QUEEN_TABLE = {
+	-20, -10, -10,  -5,  -5, -10, -10, -20,
+	-10,   0,   5,   0,   0,   0,   0, -10,
+	-10,   5,   5,   5,   5,   5,   0, -10,
+	  0,   0,   5,   5,   5,   5,   0,  -5,
+	 -5,   0,   5,   5,   5,   5,   0,  -5,
+	-10,   0,   5,   5,   5,   5,   0, -10,
+	-10,   0,   0,   0,   0,   0,   0, -10,
+	-20, -10, -10,  -5,  -5, -10, -10, -20
+};
+
+// The king hides behind its pawns while queens and rooks are about, and joins the
+// fight for the center once they are gone
+inline constexpr PieceSquareTable KING_MIDDLEGAME = {
+	 20,  30,  10,   0,   0,  10,  30,  20,
+	 20,  20,   0,   0,   0,   0,  20,  20,
+	-10, -20, -20, -20, -20, -20, -20, -10,
+	-20, -30, -30, -40, -40, -30, -30, -20,
+	-30, -40, -40, -50, -50, -40, -40, -30,
+	-30, -40, -40, -50, -50, -40, -40, -30,
+	-30, -40, -40, -50, -50, -40, -40, -30,
+	-30, -40, -40, -50, -50, -40, -40, -30
+};
+
+inline constexpr PieceSquareTable KING_ENDGAME = {
+	-50, -30, -30, -30, -30, -30, -30, -50,
+	-30, -30,   0,   0,   0,   0, -30, -30,
+	-30, -10,  20,  30,  30,  20, -10, -30,
+	-30, -10,  30,  40,  40,  30, -10, -30,
+	-30, -10,  30,  40,  40,  30, -10, -30,
+	-30, -10,  20,  30,  30,  20, -10, -30,
+	-30, -20, -10,   0,   0, -10, -20, -30,
+	-50, -40, -30, -20, -20, -30, -40, -50
+};
+
+inline constexpr std::array<PieceSquareTable, PIECE_TYPE_COUNT> MIDDLEGAME_TABLES = {	// [type]
+	PAWN_MIDDLEGAME, KNIGHT_TABLE, BISHOP_TABLE, ROOK_TABLE, QUEEN_TABLE, KING_MIDDLEGAME
+};
+
+inline constexpr std::array<PieceSquareTable, PIECE_TYPE_COUNT> ENDGAME_TABLES = {	// [type]
+	PAWN_ENDGAME, KNIGHT_TABLE, BISHOP_TABLE, ROOK_TABLE, QUEEN_TABLE, KING_ENDGAME
+};
+
+
+/**
+ * Returns the table index of a square for a piece of the given color. Black pieces
+ * move down the board, so they read the tables with the rows mirrored.
+ *
+ * @param isBlack The color of the piece.
+ * @param square The square the piece stands on.
+ * @return The index into a piece-square table.
+ */
+constexpr int pieceSquareIndex(bool isBlack, Square square) {
+	return isBlack ? (square ^ 56) : square;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+
+// A board square as a compact index (0-63), where index = row * 8 + col.
+// The row is the letter of a position ('a'-'h') and the column its digit ('1'-'8'),
+// which matches the order of the squares in the board string.
+using Square = std::uint8_t;
+
+constexpr Square NO_SQUARE = 64;	// Marks a missing square (e.g., no king on the board)
+
+
+/**
+ * Returns the row (rank letter index) of a square.
+ *
+ * @param square The square index.
+ * @return The zero-based row, 0 = 'a'.
+ */
+constexpr int squareRow(Square square) {
+	return square / 8;
+}
+
+
+/**
+ * Returns the column (file digit index) of a square.
+ *
+ * @param square The square index.
+ * @return The zero-based column, 0 = '1'.
+ */
+constexpr int squareCol(Square square) {
+	return square % 8;
+}
+
+
+/**
+ * Checks whether the given coordinates lie on the board.
+ *
+ * @param row The zero-based row.
+ * @param col The zero-based column.
+ * @return True if both coordinates are in the range 0-7.
+ */
+constexpr bool isOnBoard(int row, int col) {
+	return row >= 0 && row < 8 && col >= 0 && col < 8;
+}
+
+
+/**
+ * Builds a square from zero-based row and column coordinates.
+ *
+ * @param row The zero-based row.
+ * @param col The zero-based column.
+ * @return The square index.
+ */
+constexpr Square makeSquare(int row, int col) {
+	return static_cast<Square>(row * 8 + col);
+}
+
+
+// Conversions to and from algebraic notation, used only at the UI boundary
+std::string squareToPosition(Square square);
+Square positionToSquare(const std::string& position);
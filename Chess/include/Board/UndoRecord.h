@@ -0,0 +1,11 @@
+#pragma once
+#include "Board/Square.h"
+#include "Pieces/PieceCode.h"
+
+
+// Everything Board::unmakeMove needs to take back a move made with Board::makeMove
+struct UndoRecord {
+	Square from = NO_SQUARE;			// Square the piece moved from
+	Square to = NO_SQUARE;				// Square the piece moved to
+	PieceCode captured = NO_PIECE;		// Piece that stood on the target square, if any
+};
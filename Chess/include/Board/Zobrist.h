@@ -0,0 +1,67 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include "Board/Square.h"
+#include "Pieces/PieceType.h"
+
+
+// Random keys XOR-ed together to form a 64-bit position key
+struct ZobristKeys {
+	std::array<std::array<std::array<std::uint64_t, 64>, PIECE_TYPE_COUNT>, 2> pieces{};	// [isBlack][type][square]
+	std::uint64_t blackToMove = 0;
+};
+
+
+/**
+ * Advances a SplitMix64 generator and returns its next value.
+ * Used to fill the key table deterministically at compile time.
+ *
+ * @param state The generator state, updated in place.
+ * @return The next pseudo-random 64-bit value.
+ */
+constexpr std::uint64_t nextZobristKey(std::uint64_t& state) {
+
+	state += 0x9E3779B97F4A7C15ull;
+	std::uint64_t key = state;
+	key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ull;
+	key = (key ^ (key >> 27)) * 0x94D049BB133111EBull;
+	return key ^ (key >> 31);
+}
+
+
+/**
+ * Generates the full key table from a fixed seed.
+ *
+ * @return The Zobrist keys for every piece on every square, and for the side to move.
+ */
+constexpr ZobristKeys generateZobristKeys() {
+
+	ZobristKeys keys;
+	std::uint64_t state = 0x2545F4914F6CDD1Dull;
+
+	for (auto& color : keys.pieces) {
+		for (auto& type : color) {
+			for (auto& key : type) {
+				key = nextZobristKey(state);
+			}
+		}
+	}
+	keys.blackToMove = nextZobristKey(state);
+	return keys;
+}
+
+
+inline constexpr ZobristKeys ZOBRIST_KEYS = generateZobristKeys();
+
+
+/**
+ * Returns the key of a piece standing on a square.
+ *
+ * @param isBlack The color of the piece.
+ * @param type The type of the piece.
+ * @param square The square the piece stands on.
+ * @return The key to XOR into the position key.
+ */
+constexpr std::uint64_t zobristPieceKey(bool isBlack, PieceType type, Square square) {
+	return ZOBRIST_KEYS.pieces[isBlack][static_cast<int>(type)][square];
+}
@@ -1,20 +1,18 @@
 #pragma once
-#include <string>
+#include <array>
 #include <memory>
-#include <unordered_map>
-#include <functional>
 #include "Pieces/Piece.h"
 
 
 class PieceFactory
 {
 public:
-	using PieceCreator = std::function<std::unique_ptr<Piece>(const std::string&, bool)>;
+	using PieceCreator = std::unique_ptr<Piece>(*)(Square, bool);
 
-	static bool registerPiece(const std::string& name, PieceCreator creator);
-	static std::unique_ptr<Piece> createPiece(const std::string& name, const std::string& position, bool isBlack);
+	static std::unique_ptr<Piece> createPiece(char symbol, Square position);
+	static std::unique_ptr<Piece> createPiece(PieceType type, Square position, bool isBlack);
 
 private:
-	static std::unordered_map<std::string, PieceCreator>& getRegistry();
+	static const std::array<PieceCreator, PIECE_TYPE_COUNT> m_creators;
 
-};
\ No newline at end of file
+};
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include "Board/Board.h"
 #include "MoveResult.h"
 #include "MovementValidator.h"
@@ -10,24 +14,41 @@ class GameController
 {
 public:
 	GameController(const std::string& boardString, int wantedDepth);
+	~GameController();
 	MoveResult validateMovement(const std::string& response);
 	PriorityQueue<PossibleMovement> recommendMoves();
 	std::string formatRecommendations(const PriorityQueue<PossibleMovement>& moves);
+	void setHashSize(std::size_t sizeInMB);
+	void setTimeLimit(std::int64_t milliseconds);
+	void setNodeLimit(std::uint64_t nodes);
+	void setSearchOptions(const SearchOptions& options);
+	void setThreadCount(int threadCount);
+	void setParallelMode(ParallelMode mode);
+	void setPondering(bool isEnabled);
+	void startPondering();
+	void stopPondering();
 
 
 private:
 	Board m_board;
 	bool m_isBlackTurn;
 	MovementValidator m_movementValidator;
-	int m_depth;
+	SearchLimits m_searchLimits;
 	PossibleMoves m_recommendMoves;
+	PriorityQueue<PossibleMovement> m_recommendations;	// Last recommendations, for the current position
+	bool m_isPonderingEnabled = false;
+	std::thread m_ponderThread;							// Searches the likely replies while the player thinks
+	std::atomic<bool> m_isPonderCancelled = false;
+	std::atomic<bool> m_isPonderDone = true;
+	std::unordered_map<std::uint64_t, PriorityQueue<PossibleMovement>> m_ponderResults;	// Position key -> finished recommendations
 	
+	void ponder(Board board, PriorityQueue<PossibleMovement> replies);
 	void updateIsBlackTurn(bool isBlackTurn);
 	bool isCurrentPlayerBlack () const;
 	bool isKingInCheck(bool isBlack) const;
-	bool isValidSource(Piece* piece) const;
-	bool isMyPiece(Piece* piece) const;
-	bool canLegallyMove(Piece* piece, const std::string& target);
-	bool isSameColorAtTarget(Piece* piece, const Piece* targetPiece) const;
-	bool doesMoveCauseSelfCheck(Piece* piece, const std::string& from, const std::string& to);
+	bool isValidSource(PieceCode piece) const;
+	bool isMyPiece(PieceCode piece) const;
+	bool canLegallyMove(Square from, Square target);
+	bool isSameColorAtTarget(PieceCode piece, PieceCode targetPiece) const;
+	bool doesMoveCauseSelfCheck(PieceCode piece, Square from, Square to);
 };
\ No newline at end of file
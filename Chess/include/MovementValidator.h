@@ -1,24 +1,20 @@
 #pragma once
-#include "Pieces/Piece.h"
-#include <unordered_map>
-#include <memory>
+#include "Pieces/PieceCode.h"
+#include "Board/Board.h"
+#include <array>
 
 class MovementValidator {
 
 public:
-    using BoardMap = std::unordered_map<std::string, std::unique_ptr<Piece>>;
-
     MovementValidator() = default;
-    bool isMoveLegal(const Piece* piece, const std::string& targetPosition, const BoardMap& board) const;
-    bool isKingInCheck(bool kingColor, std::string kingPosition, const BoardMap& board) const;
+    bool isMoveLegal(Square from, Square targetPosition, const Board& board) const;
+    bool isKingInCheck(bool kingColor, Square kingPosition, const Board& board) const;
+    bool isSquareAttacked(Square square, bool byBlack, const Board& board) const;
+    std::array<Bitboard, PIECE_TYPE_COUNT> findAttackers(Square square, bool byBlack, const Board& board) const;
 
 
 private:
-    bool isPathClear(const Piece* piece, const std::string& targetPosition, const BoardMap& board) const;
-    bool isStraightPathClear(int startRow, int startCol, int endRow, int endCol, const BoardMap& board) const;
-    bool isDiagonalPathClear(int startRow, int startCol, int endRow, int endCol, const BoardMap& board) const;
-    bool isPawnMoveLegal(const Piece* piece, const std::string& targetPosition, const BoardMap& board) const;
-    bool IsIfOpponentPiecesThreatning(bool kingColor, std::string targetPosition, const BoardMap& board) const;
-    std::string coordsToPosition(int row, int col) const;
+    bool isPathClear(Square start, Square targetPosition, const Board& board) const;
+    bool isPawnMoveLegal(PieceCode piece, Square from, Square targetPosition, const Board& board) const;
 
 };
\ No newline at end of file
@@ -3,11 +3,5 @@
 
 class Knight : public Piece {
 public:
-    Knight(const std::string& position, bool isBlack);
-    std::unique_ptr<Piece> clone() const override;
-    bool isDirectionValid (const std::string& targetPosition) const override;
-
-private:
-    static bool m_register; // For registering the Knight piece in the factory
-
+    Knight(Square position, bool isBlack);
 };
\ No newline at end of file
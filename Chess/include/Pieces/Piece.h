@@ -1,27 +1,27 @@
 #pragma once
 #include <string>
-#include <unordered_map>
 #include <memory>
+#include "Board/Square.h"
+#include "Pieces/PieceCode.h"
 
 
+// A standalone piece handed out by PieceFactory. The board and the search work
+// on PieceCode values; this class wraps one together with its position.
 class Piece
 {
 public:
 
-	using BoardMap = std::unordered_map<std::string, std::unique_ptr<Piece>>;
-
-	Piece(const std::string& position, bool isBlack, const std::string& name);
-	virtual std::unique_ptr<Piece> clone() const = 0;
+	Piece(Square position, bool isBlack, PieceType type);
 	virtual ~Piece() = default;
-	virtual bool isDirectionValid(const std::string& targetPosition) const = 0;
-	void move(const std::string& targetPosition);
+	bool isDirectionValid(Square targetPosition) const;
+	void move(Square targetPosition);
 	std::string getName() const;
-	std::string getPosition() const;
+	PieceType getType() const;
+	PieceCode getCode() const;
+	Square getPosition() const;
 	bool isBlack() const;
-	std::pair<int, int> positionToCoords(const std::string& position) const;
 
 protected:
-	std::string m_name;			// The type of the piece
-	std::string m_position;		// Current position on the board
-	bool m_isBlack;				// True if black, false if white
-};
\ No newline at end of file
+	PieceCode m_code;			// The type and color of the piece
+	Square m_position;			// Current position on the board
+};
@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include "Board/Square.h"
+#include "Pieces/PieceType.h"
+
+
+// A piece as a small value: the PieceType in the low 3 bits and the color in bit 3
+using PieceCode = std::uint8_t;
+
+constexpr PieceCode NO_PIECE = 0xFF;	// Marks an empty square
+constexpr PieceCode BLACK_BIT = 0x08;
+
+
+/**
+ * Builds the code of a piece from its type and color.
+ *
+ * @param type The type of the piece.
+ * @param isBlack True for a black piece, false for white.
+ * @return The piece code.
+ */
+constexpr PieceCode makePieceCode(PieceType type, bool isBlack) {
+	return static_cast<PieceCode>(static_cast<int>(type) | (isBlack ? BLACK_BIT : 0));
+}
+
+
+/**
+ * Returns the type of a piece.
+ *
+ * @param piece The piece code, not NO_PIECE.
+ * @return The type of the piece.
+ */
+constexpr PieceType pieceType(PieceCode piece) {
+	return static_cast<PieceType>(piece & 0x07);
+}
+
+
+/**
+ * Checks whether a piece is black.
+ *
+ * @param piece The piece code, not NO_PIECE.
+ * @return True for a black piece, false for white.
+ */
+constexpr bool isBlackPiece(PieceCode piece) {
+	return piece & BLACK_BIT;
+}
+
+
+/**
+ * Builds the table mapping board-string symbols to piece codes: uppercase letters
+ * are white pieces, lowercase letters black ones, anything else maps to NO_PIECE.
+ *
+ * @return The table, indexed by the symbol's character code.
+ */
+constexpr std::array<PieceCode, 128> buildSymbolTable() {
+
+	std::array<PieceCode, 128> table{};
+	for (PieceCode& entry : table) {
+		entry = NO_PIECE;
+	}
+
+	constexpr std::array<char, PIECE_TYPE_COUNT> symbols = { 'P', 'N', 'B', 'R', 'Q', 'K' };
+	for (int type = 0; type < PIECE_TYPE_COUNT; ++type) {
+		table[symbols[type]] = makePieceCode(static_cast<PieceType>(type), false);
+		table[symbols[type] - 'A' + 'a'] = makePieceCode(static_cast<PieceType>(type), true);
+	}
+	return table;
+}
+
+inline constexpr std::array<PieceCode, 128> SYMBOL_TO_PIECE = buildSymbolTable();
+
+
+/**
+ * Returns the piece a board-string symbol stands for.
+ *
+ * @param symbol A character of the board string (e.g., 'N' or 'q').
+ * @return The piece code, or NO_PIECE for an empty or unknown symbol.
+ */
+constexpr PieceCode pieceFromSymbol(char symbol) {
+	unsigned char index = static_cast<unsigned char>(symbol);
+	return index < SYMBOL_TO_PIECE.size() ? SYMBOL_TO_PIECE[index] : NO_PIECE;
+}
+
+
+// Per-type movement shape, ignoring other pieces on the board
+bool isDirectionValid(PieceCode piece, Square from, Square to);
@@ -0,0 +1,14 @@
+#pragma once
+
+
+// The kinds of pieces on the board, used to index the per-type bitboards
+enum class PieceType {
+	Pawn,
+	Knight,
+	Bishop,
+	Rook,
+	Queen,
+	King
+};
+
+constexpr int PIECE_TYPE_COUNT = 6;
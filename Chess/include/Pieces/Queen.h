@@ -4,10 +4,5 @@
 class Queen : public Piece
 {
 public:
-	Queen(const std::string& position, bool isBlack);
-	std::unique_ptr<Piece> clone() const override;
-	bool isDirectionValid (const std::string& targetPosition) const override;
-
-private:
-	static bool m_register; // For registering the Queen piece in the factory
+	Queen(Square position, bool isBlack);
 };
\ No newline at end of file
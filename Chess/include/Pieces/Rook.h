@@ -4,10 +4,5 @@
 class Rook: public Piece
 {
 public:
-	Rook(const std::string& position, bool isBlack);
-	std::unique_ptr<Piece> clone() const override;
-	bool isDirectionValid(const std::string& targetPosition) const override;
-
-private:
-	static bool m_register; // For registering the Rook piece in the factory
+	Rook(Square position, bool isBlack);
 };
\ No newline at end of file
@@ -1,13 +1,15 @@
 #pragma once
 
-#include <list>
+#include <array>
 #include <iostream>
+#include <span>
 #include "Exceptions/EmptyQueueException.h"
 
 
 /**
  * A priority queue implementation that maintains elements in sorted order.
- * Keeps only the top 5 elements to optimize performance.
+ * Keeps only the top 5 elements to optimize performance, stored inline so
+ * pushing never allocates.
  *
  * @tparam T The type of elements stored in the queue.
  */
@@ -16,14 +18,17 @@ template <typename T>
 class PriorityQueue
 {
 public:
+	static constexpr int CAPACITY = 5;
+
 	PriorityQueue() = default;
 	void push(const T& move);	// o(n) max complexity
-	void poll();				// o(1) complexity
-	const std::list<T>& getQueue() const;
+	void poll();				// o(n) max complexity
+	std::span<const T> getQueue() const;
 	bool isEmpty() const;
 
 private:
-	std::list<T> m_queue;
+	std::array<T, CAPACITY> m_queue{};
+	int m_size = 0;
 
 };
 
@@ -70,18 +75,24 @@ template<typename T>
 void PriorityQueue<T>::push(const T& move) {
 
 	MyComparator<T> cmp;
-	auto it = m_queue.begin();
+	int index = 0;
 
-	while (it != m_queue.end() && !cmp(move, *it)) {
-		++it;
+	while (index < m_size && !cmp(move, m_queue[index])) {
+		++index;
 	}
 
-	m_queue.insert(it, move);
-
 	// Keep only 5 best moves
-	if (m_queue.size() > 5) {
-		m_queue.pop_back();
+	if (index == CAPACITY) {
+		return;
 	}
+	if (m_size < CAPACITY) {
+		++m_size;
+	}
+
+	for (int i = m_size - 1; i > index; --i) {
+		m_queue[i] = m_queue[i - 1];
+	}
+	m_queue[index] = move;
 }
 
 
@@ -93,22 +104,26 @@ void PriorityQueue<T>::push(const T& move) {
 template<typename T>
 void PriorityQueue<T>::poll() {
 	
-	if (m_queue.empty()) {
+	if (m_size == 0) {
 		throw EmptyQueueException();
 	}
-	m_queue.pop_front();
+
+	for (int i = 1; i < m_size; ++i) {
+		m_queue[i - 1] = m_queue[i];
+	}
+	--m_size;
 }
 
 
 /**
- * Returns a constant reference to the underlying queue.
+ * Returns a view of the queued elements, best first.
  *
- * @return A constant reference to the list containing all elements.
+ * @return A view of the stored elements.
  */
 template<typename T>
-const std::list<T>& PriorityQueue<T>::getQueue() const
+std::span<const T> PriorityQueue<T>::getQueue() const
 {
-	return m_queue;
+	return { m_queue.data(), static_cast<std::size_t>(m_size) };
 }
 
 
@@ -119,7 +134,7 @@ const std::list<T>& PriorityQueue<T>::getQueue() const
  */
 template<typename T>
 bool PriorityQueue<T>::isEmpty() const {
-	return m_queue.empty();
+	return m_size == 0;
 }
 
 
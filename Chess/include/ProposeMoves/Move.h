@@ -0,0 +1,131 @@
+#pragma once
+#include <cstdint>
+#include "Board/Square.h"
+
+
+/**
+ * A move of the piece on one square to another square, packed into 16 bits:
+ * the source square in bits 0-5, the destination in bits 6-11 and flags above.
+ * The all-zero value (a1 to a1) can never be a real move and marks "no move".
+ */
+class Move
+{
+public:
+	static constexpr std::uint16_t CAPTURE_FLAG = 1 << 12;		// The destination holds an opponent piece
+	static constexpr std::uint16_t DOUBLE_PUSH_FLAG = 1 << 13;	// A pawn moving two squares from its start row
+
+	constexpr Move() = default;
+	constexpr Move(Square from, Square to, std::uint16_t flags = 0);
+	static constexpr Move fromData(std::uint16_t data);
+
+	constexpr Square getFrom() const;
+	constexpr Square getTo() const;
+	constexpr bool isCapture() const;
+	constexpr bool isDoublePush() const;
+	constexpr bool isNull() const;
+	constexpr std::uint16_t getData() const;
+	constexpr bool operator==(const Move& other) const;
+
+private:
+	std::uint16_t m_data = 0;
+};
+
+
+//-----------------------------------------------------------------------------
+// Function definitions
+//-----------------------------------------------------------------------------
+
+/**
+ * Packs a move from its squares and flags.
+ *
+ * @param from The square the piece moves from.
+ * @param to The square the piece moves to.
+ * @param flags A combination of the flag constants, 0 for a quiet move.
+ */
+constexpr Move::Move(Square from, Square to, std::uint16_t flags)
+	: m_data(static_cast<std::uint16_t>(from | (to << 6) | flags)) {}
+
+
+/**
+ * Rebuilds a move from its packed form.
+ *
+ * @param data A value returned by getData.
+ * @return The move it encodes.
+ */
+constexpr Move Move::fromData(std::uint16_t data) {
+
+	Move move;
+	move.m_data = data;
+	return move;
+}
+
+
+/**
+ * Returns the square the piece moves from.
+ *
+ * @return The source square.
+ */
+constexpr Square Move::getFrom() const {
+	return static_cast<Square>(m_data & 0x3F);
+}
+
+
+/**
+ * Returns the square the piece moves to.
+ *
+ * @return The destination square.
+ */
+constexpr Square Move::getTo() const {
+	return static_cast<Square>((m_data >> 6) & 0x3F);
+}
+
+
+/**
+ * Checks whether the move captures an opponent piece.
+ *
+ * @return True for a capture.
+ */
+constexpr bool Move::isCapture() const {
+	return m_data & CAPTURE_FLAG;
+}
+
+
+/**
+ * Checks whether the move is a pawn's two-square push.
+ *
+ * @return True for a double push.
+ */
+constexpr bool Move::isDoublePush() const {
+	return m_data & DOUBLE_PUSH_FLAG;
+}
+
+
+/**
+ * Checks whether this is the empty "no move" value.
+ *
+ * @return True if the move holds no squares.
+ */
+constexpr bool Move::isNull() const {
+	return m_data == 0;
+}
+
+
+/**
+ * Returns the move packed into 16 bits, for storing it in other packed values.
+ *
+ * @return The packed squares and flags.
+ */
+constexpr std::uint16_t Move::getData() const {
+	return m_data;
+}
+
+
+/**
+ * Compares two moves, including their flags.
+ *
+ * @param other The move to compare with.
+ * @return True if both moves are identical.
+ */
+constexpr bool Move::operator==(const Move& other) const {
+	return m_data == other.m_data;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Board/Board.h"
+#include "ProposeMoves/MoveList.h"
+
+class MoveGenerator {
+
+public:
+    MoveGenerator() = default;
+    void generateMoves(const Board& board, bool isBlack, MoveList& moves) const;
+    void generateCaptures(const Board& board, bool isBlack, MoveList& moves) const;
+    Bitboard attacksFrom(PieceCode piece, Square square, Bitboard occupied) const;
+
+private:
+    void generateMovesTo(const Board& board, bool isBlack, Bitboard allowedTargets, MoveList& moves) const;
+    Bitboard pawnTargets(Square from, bool isBlack, Bitboard occupied, Bitboard opponents) const;
+    Bitboard pieceAttacks(PieceType type, Square square, Bitboard occupied) const;
+};
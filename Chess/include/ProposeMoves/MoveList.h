@@ -0,0 +1,167 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <utility>
+#include "ProposeMoves/Move.h"
+
+
+// A move together with the score the search assigned to it
+struct ScoredMove {
+	Move move;
+	std::int32_t score = 0;
+};
+
+
+/**
+ * A fixed-capacity list of moves that lives on the stack, so generating
+ * moves in a search node never allocates. Each move carries its own score.
+ */
+class MoveList
+{
+public:
+	static constexpr int MAX_MOVES = 256;	// More than any position from the board string can produce
+
+	void push(Move move);
+	int size() const;
+	bool isEmpty() const;
+	Move operator[](int index) const;
+	int getScore(int index) const;
+	void setScore(int index, int score);
+	void sortByScore();
+	Move pickBest(int index);
+	const ScoredMove* begin() const;
+	const ScoredMove* end() const;
+
+private:
+	std::array<ScoredMove, MAX_MOVES> m_moves;
+	int m_size = 0;
+};
+
+
+//-----------------------------------------------------------------------------
+// Function definitions
+//-----------------------------------------------------------------------------
+
+/**
+ * Appends a move with a zero score to the list. Moves beyond the capacity are dropped.
+ *
+ * @param move The move to append.
+ */
+inline void MoveList::push(Move move) {
+	if (m_size < MAX_MOVES) {
+		m_moves[m_size++] = ScoredMove{ move, 0 };
+	}
+}
+
+
+/**
+ * Returns the number of moves in the list.
+ *
+ * @return The move count.
+ */
+inline int MoveList::size() const {
+	return m_size;
+}
+
+
+/**
+ * Checks if the list holds no moves.
+ *
+ * @return True if the list is empty, false otherwise.
+ */
+inline bool MoveList::isEmpty() const {
+	return m_size == 0;
+}
+
+
+/**
+ * Returns the move at the given position in the list.
+ *
+ * @param index The position of the move, less than size().
+ * @return The move.
+ */
+inline Move MoveList::operator[](int index) const {
+	return m_moves[index].move;
+}
+
+
+/**
+ * Returns the score stored with a move.
+ *
+ * @param index The position of the move, less than size().
+ * @return The move's score.
+ */
+inline int MoveList::getScore(int index) const {
+	return m_moves[index].score;
+}
+
+
+/**
+ * Stores a score with a move.
+ *
+ * @param index The position of the move, less than size().
+ * @param score The score to store.
+ */
+inline void MoveList::setScore(int index, int score) {
+	m_moves[index].score = score;
+}
+
+
+/**
+ * Orders the moves from the highest score to the lowest. Moves with equal
+ * scores keep their relative order.
+ */
+inline void MoveList::sortByScore() {
+
+	for (int i = 1; i < m_size; ++i) {
+		ScoredMove entry = m_moves[i];
+		int j = i;
+
+		while (j > 0 && m_moves[j - 1].score < entry.score) {
+			m_moves[j] = m_moves[j - 1];
+			--j;
+		}
+		m_moves[j] = entry;
+	}
+}
+
+
+/**
+ * Moves the highest-scored move among the ones from the given position onwards
+ * to that position. Picking moves one at a time this way only sorts as much
+ * of the list as the search actually visits.
+ *
+ * @param index The position to fill, less than size().
+ * @return The move now at that position.
+ */
+inline Move MoveList::pickBest(int index) {
+
+	int best = index;
+	for (int i = index + 1; i < m_size; ++i) {
+		if (m_moves[i].score > m_moves[best].score) {
+			best = i;
+		}
+	}
+	std::swap(m_moves[index], m_moves[best]);
+	return m_moves[index].move;
+}
+
+
+/**
+ * Returns a pointer to the first scored move, for range-based loops.
+ *
+ * @return A pointer to the first entry.
+ */
+inline const ScoredMove* MoveList::begin() const {
+	return m_moves.data();
+}
+
+
+/**
+ * Returns a pointer past the last scored move, for range-based loops.
+ *
+ * @return A pointer past the last entry.
+ */
+inline const ScoredMove* MoveList::end() const {
+	return m_moves.data() + m_size;
+}
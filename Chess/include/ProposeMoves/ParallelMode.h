@@ -0,0 +1,9 @@
+#pragma once
+
+
+// How a search with several threads divides the work between them
+enum class ParallelMode {
+	RootSplit,	// Each root move is searched by one thread, each thread has its own table
+	LazySmp,	// All threads search the whole tree and share one table
+	WorkStealing	// Threads steal the later moves of nodes whose first move is searched
+};
@@ -1,23 +1,29 @@
 #pragma once
 
-#include <string>
+#include <array>
 #include <ostream>
+#include <span>
+#include "ProposeMoves/Move.h"
 
 class PossibleMovement {
+public:
+	static constexpr int MAX_LINE_LENGTH = 64;
+
 private:
 	int m_score = 0;
-	std::string m_from;
-	std::string m_destination;
+	Move m_move;
+	std::array<Move, MAX_LINE_LENGTH> m_line{};	// Expected continuation, starting with m_move
+	int m_lineLength = 0;
 
 public:
 	PossibleMovement() : m_score(0) {}
-	void setFrom(const std::string& from);
-	void setDestination(const std::string& to);
+	void setMove(Move move);
 	void setScore(int score);
+	void setLine(std::span<const Move> line);
 	
 	int getScore()const;
-	const std::string& getFrom() const;
-	const std::string& getDestination() const;
+	Move getMove() const;
+	std::span<const Move> getLine() const;
 };
 
 
@@ -4,28 +4,140 @@
 #include "MovementValidator.h"
 #include "PriorityQueue.h"
 #include "ProposeMoves/PossibleMovement.h"
+#include "ProposeMoves/MoveGenerator.h"
+#include "ProposeMoves/TranspositionTable.h"
+#include "ProposeMoves/SearchLimits.h"
+#include "ProposeMoves/SearchOptions.h"
+#include "ProposeMoves/ParallelMode.h"
+#include "ProposeMoves/WorkStealingDeque.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <vector>
-#include <string>
 
-class PossibleMoves {
+// Aligned to a cache line so the searchers of different threads never share one
+class alignas(64) PossibleMoves {
 public:
 
+    static constexpr std::size_t DEFAULT_HASH_SIZE_MB = 16;
+    static constexpr int MAX_PLY = 64;     // Deepest distance from the root the search reaches
+    static constexpr int MAX_THREADS = 256;
+
     PossibleMoves(const MovementValidator& movementValidator);
     void findPossibleMoves(int numOfTurns, bool isBlack, const Board& board);
+    void findPossibleMoves(const SearchLimits& limits, bool isBlack, const Board& board);
+    void stop();
     const PriorityQueue<PossibleMovement>& getBestMoves() const;
+    void setHashSize(std::size_t sizeInMB);
+    void setSearchOptions(const SearchOptions& options);
+    void setThreadCount(int threadCount);
+    void setParallelMode(ParallelMode mode);
 
 private:
-    bool m_recommendForBlack = false;	// the color of the player we recommend the moves
-	bool m_isBlackTurn = false;			// the color of the current player in the recursion
+    // A node whose later moves are shared between threads. Lives in its owner's pool
+    // at the node's ply until all its moves are searched.
+    struct SplitPoint {
+        Board board{ std::string(64, '#') };    // Position at the node
+        MoveList moves;                         // Moves of the node, ordered
+        int ply = 0;
+        int depth = 0;
+        int beta = 0;
+        bool isInCheck = false;
+        bool isFutile = false;
+        const SplitPoint* parent = nullptr;     // Split point the owner was working for, if any
+        std::atomic<int> alpha = 0;             // Best score so far, raised by any thread
+        std::atomic<int> legalMoves = 0;        // Legal moves taken so far, numbers the next one
+        std::atomic<int> pendingMoves = 0;      // Moves not yet searched to the end
+        std::atomic<bool> isAborted = false;    // A cutoff made the remaining moves useless
+        std::mutex resultMutex;                 // Guards the best move and line below
+        int bestScore = 0;
+        Move bestMove;
+        std::array<Move, MAX_PLY> line{};
+        int lineLength = 0;
+    };
+
+    // An iteration over the root moves, handed by the owner to its root-splitting helpers
+    struct RootIteration {
+        std::mutex mutex;                       // Guards everything below but the move counter
+        std::condition_variable start;          // Wakes the helpers for an iteration or the end of the search
+        std::condition_variable finish;         // Wakes the owner when the last helper is done
+        const Board* board = nullptr;           // Root position, each helper searches a copy
+        MoveList* moves = nullptr;              // Root moves, shared by all threads
+        int depth = 0;
+        std::atomic<int> nextMove = 0;          // Index of the next root move to search
+        int generation = 0;                     // Iterations handed out in this search
+        int runningHelpers = 0;                 // Helpers still searching the iteration
+    };
+
+    // A move of a split point: owner in bits 24-31, ply in bits 16-23, move index below
+    using SplitTask = std::uint32_t;
+    static constexpr std::size_t TASK_CAPACITY = 1 << 14;   // Moves per split point times split points per thread
+
     MovementValidator m_movementValidator;
+    MoveGenerator m_moveGenerator;
     PriorityQueue<PossibleMovement> m_bestMoves;
+    TranspositionTable m_transpositionTable;   // positions searched so far, kept between turns
+    TranspositionTable* m_table = &m_transpositionTable;    // the table this searcher uses, a helper's may be its owner's
+    ParallelMode m_parallelMode = ParallelMode::RootSplit;  // how the threads share a search
+    std::size_t m_hashSizeMB = DEFAULT_HASH_SIZE_MB;    // memory shared by the tables of all threads
+    std::vector<std::unique_ptr<PossibleMoves>> m_helpers;  // searchers of the other threads, each with its own state
+    std::array<std::array<Move, MAX_PLY>, MAX_PLY> m_pvTable{};    // [ply] -> best line found from that ply
+    std::array<int, MAX_PLY> m_pvLength{};                          // [ply] -> length of that line
+    std::array<Move, MAX_PLY> m_playedMoves{};                      // [ply] -> move being searched at that ply
+    std::array<std::array<Move, 2>, MAX_PLY> m_killers{};           // [ply] -> quiet moves that caused cutoffs there
+    std::array<std::array<Move, 64>, 64> m_counterMoves{};          // [from][to] of a move -> quiet move refuting it
+    std::array<std::array<std::array<int, 64>, 64>, 2> m_history{}; // [isBlack][from][to] -> quiet cutoff score
+    SearchLimits m_limits;                              // limits of the running search
+    SearchOptions m_options;                            // selective techniques the search uses
+    bool m_isVerifyingNullMove = false;                 // no null moves while a null-move cutoff is verified
+    std::uint64_t m_nodes = 0;                          // positions searched so far
+    std::chrono::steady_clock::time_point m_startTime;  // when the running search started
+    std::atomic<bool> m_stopRequested = false;          // set to make the running search unwind
+    std::atomic<bool>* m_stopFlag = &m_stopRequested;   // the flag this searcher obeys, a helper's points to its owner's
+    PossibleMoves* m_owner = this;                      // the searcher that owns the helpers, itself for the owner
+    int m_threadIndex = 0;                              // 0 for the owner, 1 + helper index for helpers
+    std::unique_ptr<std::array<SplitPoint, MAX_PLY>> m_splitPoints;    // [ply] -> split point this thread opened there
+    const SplitPoint* m_splitPoint = nullptr;           // split point of the move this thread is searching
+    WorkStealingDeque<SplitTask, TASK_CAPACITY> m_tasks;    // split point moves other threads may take
+    std::atomic<bool> m_isSearchDone = false;           // tells waiting helpers the owner's search has finished
+    RootIteration m_rootIteration;                      // the iteration root-splitting helpers work on
 
 
-    // Helper methods for the Min-Max algorithm
-    int calculateMoveScore(Board& boardBefore, Board& boardAfter, const std::string& from, const std::string& to);
-	int minMax(Board& board, bool isBlackTurn, int depth, int maxDepth);
-    int getPieceValue(const Piece* piece) const;
-
-    // Utility methods
-    std::vector<std::string> allPositionsOnBoard() const;
+    // Helper methods for the alpha-beta search
+    int calculateMoveScore(const Board& board, PieceCode capturedPiece, Square to);
+    void startSearch(const SearchLimits& limits, std::chrono::steady_clock::time_point startTime);
+    void searchAsHelper(Board board, MoveList moves, int maxDepth, int helperIndex);
+    void searchRootAsHelper();
+    void searchRootInParallel(const Board& board, int depth, MoveList& moves, PriorityQueue<PossibleMovement>& bestMoves);
+    void searchRoot(Board& board, int depth, MoveList& moves, std::atomic<int>& nextMove, PriorityQueue<PossibleMovement>& bestMoves);
+    int searchRootMove(Board& board, int depth, int lowerBound);
+    int alphaBeta(Board& board, int ply, int depth, int alpha, int beta);
+    int searchMove(Board& board, int ply, int depth, int alpha, int beta, Move move, int moveNumber, bool isInCheck, bool isFutile);
+    bool canSplit(int depth) const;
+    void searchSplitPoint(SplitPoint& splitPoint, int firstMove);
+    void searchSplitMove(SplitPoint& splitPoint, int moveIndex);
+    void runTask(SplitTask task);
+    void stealUntilSearchDone();
+    PossibleMoves& getThread(int threadIndex);
+    int quiescence(Board& board, int ply, int quiescenceDepth, int alpha, int beta);
+    int evaluate(const Board& board) const;
+    void orderMoves(const Board& board, MoveList& moves, int ply, Move hashMove) const;
+    void recordQuietCutoff(bool isBlack, int ply, int depth, Move move);
+    void ageHistory();
+    void resetMoveOrdering();
+    bool isStopped() const;
+    bool isBudgetUsed(int divisor) const;
+    void updatePrincipalVariation(int ply, Move move);
+    int scoreToTable(int score, int ply) const;
+    int scoreFromTable(int score, int ply) const;
+    int getPieceValue(PieceCode piece) const;
+    bool isKingExposed(const Board& board, bool isBlack) const;
+    bool hasOnlyPawns(const Board& board, bool isBlack) const;
+    bool isMateScore(int score) const;
+    int getLateMoveReduction(bool isBlack, int depth, int moveNumber, Move move) const;
 };
\ No newline at end of file
@@ -0,0 +1,11 @@
+#pragma once
+#include <cstdint>
+
+
+// When a recommendation search stops deepening. A zero budget means no limit of that kind;
+// the search always finishes at least the iteration that scores moves by their immediate effect.
+struct SearchLimits {
+	int depth = 0;					// Deepest iteration, in moves after the recommended one
+	std::int64_t timeMs = 0;		// Wall-clock budget in milliseconds
+	std::uint64_t nodes = 0;		// Budget of searched positions
+};
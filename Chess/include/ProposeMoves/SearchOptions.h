@@ -0,0 +1,12 @@
+#pragma once
+
+
+// Selective techniques the search may use to skip or shorten lines that are unlikely
+// to matter. All are on by default; turning one off measures what it costs or saves.
+struct SearchOptions {
+	bool nullMove = true;				// Prove a cutoff by letting the opponent move twice
+	bool lateMoveReductions = true;		// Search late quiet moves shallower first
+	bool futility = true;				// Skip quiet moves near the horizon that can't reach alpha
+	bool reverseFutility = true;		// Cut near the horizon when the evaluation is far above beta
+	bool razoring = true;				// Settle hopeless positions near the horizon by quiescence
+};
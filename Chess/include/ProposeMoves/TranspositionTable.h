@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "ProposeMoves/Move.h"
+
+
+// How a stored score relates to the true value of the position
+enum class BoundType : std::uint8_t {
+	None,	// Empty entry
+	Exact,	// The score is the exact value
+	Lower,	// The true value is at least the score
+	Upper	// The true value is at most the score
+};
+
+
+// One cached search result, as read from the table
+struct TranspositionEntry {
+	std::uint64_t key = 0;				// Full Zobrist key of the position
+	std::int32_t score = 0;				// Score from the point of view of the side to move
+	Move bestMove;						// Best move found, a null move if none
+	std::int8_t depth = 0;				// Remaining depth the score was searched to
+	std::uint8_t boundAndAge = 0;		// Bound type in the low 2 bits, search generation above
+
+	BoundType getBound() const;
+	std::uint8_t getAge() const;
+};
+
+
+/**
+ * A fixed-size hash table of search results keyed by position.
+ * Entries are grouped in cache-line sized buckets; a position can only live in
+ * the bucket selected by its key, and the number of buckets is a power of two.
+ * Several threads may probe and store at once without locks: an entry is two atomic
+ * words, its data and its key XOR its data, so an entry torn by concurrent writes no
+ * longer matches its key and is ignored. resize, clear and newSearch are not thread safe.
+ */
+class TranspositionTable
+{
+public:
+	static constexpr int BUCKET_SIZE = 4;
+
+	TranspositionTable(std::size_t sizeInMB);
+	void resize(std::size_t sizeInMB);
+	void clear();
+	void newSearch();
+	bool probe(std::uint64_t key, TranspositionEntry& entry) const;
+	void store(std::uint64_t key, int depth, int score, BoundType bound, Move bestMove);
+
+private:
+	// An entry packed into two words written independently
+	struct Slot {
+		std::atomic<std::uint64_t> check{ 0 };	// Key XOR data
+		std::atomic<std::uint64_t> data{ 0 };	// Score, move, depth, bound and age
+	};
+
+	struct alignas(64) Bucket {
+		std::array<Slot, BUCKET_SIZE> slots;
+	};
+
+	std::unique_ptr<Bucket[]> m_buckets;
+	std::uint64_t m_mask = 0;		// Bucket count - 1, selects a bucket from a key
+	std::uint8_t m_age = 0;			// Current search generation
+
+	Bucket& bucketFor(std::uint64_t key);
+	const Bucket& bucketFor(std::uint64_t key) const;
+	int replacementPriority(const TranspositionEntry& entry) const;
+	static TranspositionEntry readSlot(const Slot& slot);
+	static void writeSlot(Slot& slot, const TranspositionEntry& entry);
+};
@@ -0,0 +1,109 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * A Chase-Lev work-stealing deque of fixed capacity. Its owner thread pushes and pops
+ * at the bottom, like a stack; any other thread may steal from the top, taking the
+ * oldest item. Neither side takes a lock: thieves and the owner only race for the last
+ * item, which a compare-and-swap on the top index settles.
+ * The capacity must cover the most items the owner ever holds at once.
+ *
+ * @tparam T A small trivially copyable item type that std::atomic handles without locks.
+ * @tparam CAPACITY The number of slots, a power of two.
+ */
+template <typename T, std::size_t CAPACITY>
+class WorkStealingDeque
+{
+public:
+	static_assert((CAPACITY & (CAPACITY - 1)) == 0, "The capacity must be a power of two");
+
+	bool push(T item);
+	bool pop(T& item);
+	bool steal(T& item);
+
+private:
+	static constexpr std::int64_t MASK = CAPACITY - 1;
+
+	std::array<std::atomic<T>, CAPACITY> m_items{};
+	alignas(64) std::atomic<std::int64_t> m_top = 0;		// Next item to steal, only ever increases
+	alignas(64) std::atomic<std::int64_t> m_bottom = 0;		// One past the owner's newest item
+};
+
+
+//-----------------------------------------------------------------------------
+// Function definitions
+//-----------------------------------------------------------------------------
+
+/**
+ * Adds an item at the bottom. Owner thread only.
+ *
+ * @param item The item to add.
+ * @return False if the deque is full and the item was not added.
+ */
+template <typename T, std::size_t CAPACITY>
+bool WorkStealingDeque<T, CAPACITY>::push(T item) {
+
+	std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+	std::int64_t top = m_top.load(std::memory_order_acquire);
+	if (bottom - top >= static_cast<std::int64_t>(CAPACITY)) {
+		return false;
+	}
+
+	m_items[bottom & MASK].store(item, std::memory_order_relaxed);
+	m_bottom.store(bottom + 1, std::memory_order_release);
+	return true;
+}
+
+
+/**
+ * Takes the newest item from the bottom. Owner thread only.
+ *
+ * @param item Receives the item.
+ * @return False if the deque was empty or a thief took the last item.
+ */
+template <typename T, std::size_t CAPACITY>
+bool WorkStealingDeque<T, CAPACITY>::pop(T& item) {
+
+	std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+	m_bottom.store(bottom, std::memory_order_seq_cst);
+	std::int64_t top = m_top.load(std::memory_order_seq_cst);
+
+	if (top > bottom) {
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return false;
+	}
+
+	item = m_items[bottom & MASK].load(std::memory_order_relaxed);
+	if (top == bottom) {
+
+		// the last item: whoever moves the top first gets it
+		bool isTaken = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return isTaken;
+	}
+	return true;
+}
+
+
+/**
+ * Takes the oldest item from the top. Safe to call from any thread.
+ *
+ * @param item Receives the item.
+ * @return False if the deque was empty or another thread took the item first.
+ */
+template <typename T, std::size_t CAPACITY>
+bool WorkStealingDeque<T, CAPACITY>::steal(T& item) {
+
+	std::int64_t top = m_top.load(std::memory_order_seq_cst);
+	std::int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+	if (top >= bottom) {
+		return false;
+	}
+
+	item = m_items[top & MASK].load(std::memory_order_relaxed);
+	return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+}
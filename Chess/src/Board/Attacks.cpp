@@ -0,0 +1,218 @@
+#include "Board/Attacks.h"
+#include <array>
+#include <vector>
+
+
+/**
+ * Magic bitboard lookup data for one square.
+ * Multiplying the relevant blockers by the magic number and shifting packs every
+ * blocker configuration into a unique index of the square's attack table.
+ */
+struct Magic {
+	Bitboard mask = 0;			// Squares whose occupancy can block a ray (edges excluded)
+	Bitboard magic = 0;			// Multiplier that maps blocker sets to distinct indices
+	int shift = 0;				// 64 minus the number of relevant squares
+	std::size_t offset = 0;		// Start of this square's entries in the attack table
+
+	std::size_t index(Bitboard occupied) const {
+		return offset + static_cast<std::size_t>(((occupied & mask) * magic) >> shift);
+	}
+};
+
+
+// The magic numbers and attack tables for one kind of slider
+struct SliderTable {
+	std::array<Magic, 64> magics;
+	std::vector<Bitboard> attacks;
+};
+
+
+// Magic numbers that give a collision-free index for every blocker set on each square.
+// Found offline by trying sparse random numbers; any value passing that test works.
+const Bitboard ROOK_MAGICS[64] = {
+	0x8080102040008000ull, 0x5440041000200048ull, 0x008020008010000Aull, 0x0200084200100420ull,
+	0x0200081020040200ull, 0x0600019002002824ull, 0x040050811008020Cull, 0x0100004881000126ull,
+	0x0005800440008020ull, 0x2882002042090880ull, 0x0002802000801004ull, 0x0240808010000800ull,
+	0x4480800800040082ull, 0x0408808004000200ull, 0x00BA0004A8020001ull, 0x1106000042040091ull,
+	0x0020208010400080ull, 0x0022060045028020ull, 0x0020008020100080ull, 0x0202020008102041ull,
+	0x0C50808008000400ull, 0x0068808002000400ull, 0x00510400C8100201ull, 0x400006000100A444ull,
+	0x483424818008400Aull, 0x8840008080200040ull, 0x0800100080802000ull, 0x0440100080800800ull,
+	0x4000080080040080ull, 0x9124040080020080ull, 0x0089000300040E00ull, 0x080001020020488Cull,
+	0x9040002040800080ull, 0x80D0002001400242ull, 0x0000401901002002ull, 0x0030220901001000ull,
+	0x0080580005003100ull, 0x0022006C0A001008ull, 0x0802301144001248ull, 0x0020010042000084ull,
+	0x4AC0400084228004ull, 0x0010004020004000ull, 0x3110004020010100ull, 0x0598100009050020ull,
+	0x4200080011010004ull, 0x0818020004008080ull, 0x02A0708102040008ull, 0x5201010080420004ull,
+	0x100B124063800100ull, 0x7808200240048980ull, 0x8800200010008080ull, 0x1099201001000900ull,
+	0x0100050010080100ull, 0x0400800200040080ull, 0x2040280190020400ull, 0x00100C0100608200ull,
+	0x0000201241088202ull, 0x1040002042801B01ull, 0x0124090010200041ull, 0x0831002004081001ull,
+	0x2003000800021005ull, 0x80010002040008C1ull, 0x0208008122081004ull, 0x4000008844002102ull
+};
+
+const Bitboard BISHOP_MAGICS[64] = {
+	0x0020011019010028ull, 0x0122100912208000ull, 0x1498082308200080ull, 0x0004106600000000ull,
+	0x2082021000405600ull, 0x68508804C0820201ull, 0xA004140422080010ull, 0x0120402084202004ull,
+	0x0000F0101014C080ull, 0x014002300A022041ull, 0x000084080A004020ull, 0x2061949202010083ull,
+	0x0407820210050008ull, 0x00500101084008A2ull, 0x2000040404420880ull, 0x00090044041C0710ull,
+	0x0804004030841140ull, 0x002580A001240100ull, 0x2081000214090200ull, 0x0812022C01220050ull,
+	0x0602001012100010ull, 0x0003004080454024ull, 0x0000400088084800ull, 0x8000800040480850ull,
+	0x1010040110602230ull, 0x8428204002044D32ull, 0x0340240028880200ull, 0x1804080018220040ull,
+	0x0C10101041004001ull, 0x0422208008080100ull, 0x0010810610941000ull, 0x0302122002050140ull,
+	0x8304104008054400ull, 0x1000AC5003A45026ull, 0x0202402080100508ull, 0xC801042008040100ull,
+	0x00400020210A0080ull, 0x4010404200004104ull, 0x0401180120008C00ull, 0x0811450200110052ull,
+	0xB10110825000A020ull, 0x8104008405001050ull, 0x0908094050030803ull, 0x000414C204800804ull,
+	0x2000202414004042ull, 0x044001040020A100ull, 0x0008100400440082ull, 0x210101050A040102ull,
+	0x8004442420080000ull, 0x0906008421080000ull, 0x0220208048081004ull, 0x0000004084240800ull,
+	0x00080020A0864200ull, 0x40010484880E0000ull, 0x9040100440808008ull, 0x0010028089020002ull,
+	0x100082004202C000ull, 0x4049051042022000ull, 0x010100010C110400ull, 0x8200000B02208810ull,
+	0x0000001008210100ull, 0x0000180410241840ull, 0x0880100401680A01ull, 0x04021A0809040081ull
+};
+
+
+// Row/column steps of the rook and bishop rays
+const int ROOK_DIRECTIONS[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+const int BISHOP_DIRECTIONS[4][2] = { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+
+/**
+ * Computes slider attacks by walking each ray until it leaves the board or hits a piece.
+ * Only used to build the tables.
+ *
+ * @param square The square of the slider.
+ * @param occupied The occupied squares.
+ * @param directions The four ray directions of the slider.
+ * @return The attacked squares.
+ */
+static Bitboard slowSliderAttacks(Square square, Bitboard occupied, const int directions[4][2]) {
+
+	Bitboard attacks = 0;
+	for (int i = 0; i < 4; ++i) {
+		int row = squareRow(square) + directions[i][0];
+		int col = squareCol(square) + directions[i][1];
+
+		while (isOnBoard(row, col)) {
+			Bitboard target = squareMask(makeSquare(row, col));
+			attacks |= target;
+			if (occupied & target) {
+				break;
+			}
+			row += directions[i][0];
+			col += directions[i][1];
+		}
+	}
+	return attacks;
+}
+
+
+/**
+ * Computes the squares that can block a slider's rays. The last square of each ray
+ * is left out, since a piece there never shortens the ray.
+ *
+ * @param square The square of the slider.
+ * @param directions The four ray directions of the slider.
+ * @return The relevant blocker squares.
+ */
+static Bitboard blockerMask(Square square, const int directions[4][2]) {
+
+	Bitboard mask = 0;
+	for (int i = 0; i < 4; ++i) {
+		int row = squareRow(square) + directions[i][0];
+		int col = squareCol(square) + directions[i][1];
+
+		while (isOnBoard(row + directions[i][0], col + directions[i][1])) {
+			mask |= squareMask(makeSquare(row, col));
+			row += directions[i][0];
+			col += directions[i][1];
+		}
+	}
+	return mask;
+}
+
+
+/**
+ * Fills the attack table of a slider from its precomputed magic numbers.
+ *
+ * @param directions The four ray directions of the slider.
+ * @param magicNumbers The magic number of every square.
+ * @return The complete lookup table for the slider.
+ */
+static SliderTable buildSliderTable(const int directions[4][2], const Bitboard magicNumbers[64]) {
+
+	SliderTable table;
+
+	for (int square = 0; square < 64; ++square) {
+		Magic& magic = table.magics[square];
+		magic.mask = blockerMask(static_cast<Square>(square), directions);
+		magic.magic = magicNumbers[square];
+		magic.shift = 64 - countSquares(magic.mask);
+		magic.offset = table.attacks.size();
+		table.attacks.resize(magic.offset + (std::size_t{ 1 } << countSquares(magic.mask)));
+
+		// enumerate every subset of the mask (carry-rippler) and store its attacks
+		Bitboard subset = 0;
+		do {
+			table.attacks[magic.index(subset)] = slowSliderAttacks(static_cast<Square>(square), subset, directions);
+			subset = (subset - magic.mask) & magic.mask;
+		} while (subset);
+	}
+	return table;
+}
+
+
+/**
+ * Returns the rook lookup table, built on first use.
+ *
+ * @return The rook magic table.
+ */
+static const SliderTable& rookTable() {
+	static const SliderTable table = buildSliderTable(ROOK_DIRECTIONS, ROOK_MAGICS);
+	return table;
+}
+
+
+/**
+ * Returns the bishop lookup table, built on first use.
+ *
+ * @return The bishop magic table.
+ */
+static const SliderTable& bishopTable() {
+	static const SliderTable table = buildSliderTable(BISHOP_DIRECTIONS, BISHOP_MAGICS);
+	return table;
+}
+
+
+/**
+ * Returns the squares a rook attacks: one multiply, one shift and one table load.
+ *
+ * @param square The square of the rook.
+ * @param occupied The occupied squares on the board.
+ * @return The attacked squares, including the first blocker on each ray.
+ */
+Bitboard rookAttacks(Square square, Bitboard occupied) {
+	const SliderTable& table = rookTable();
+	return table.attacks[table.magics[square].index(occupied)];
+}
+
+
+/**
+ * Returns the squares a bishop attacks: one multiply, one shift and one table load.
+ *
+ * @param square The square of the bishop.
+ * @param occupied The occupied squares on the board.
+ * @return The attacked squares, including the first blocker on each ray.
+ */
+Bitboard bishopAttacks(Square square, Bitboard occupied) {
+	const SliderTable& table = bishopTable();
+	return table.attacks[table.magics[square].index(occupied)];
+}
+
+
+/**
+ * Returns the squares a queen attacks, the union of the rook and bishop attacks.
+ *
+ * @param square The square of the queen.
+ * @param occupied The occupied squares on the board.
+ * @return The attacked squares, including the first blocker on each ray.
+ */
+Bitboard queenAttacks(Square square, Bitboard occupied) {
+	return rookAttacks(square, occupied) | bishopAttacks(square, occupied);
+}
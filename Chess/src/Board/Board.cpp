@@ -1,19 +1,24 @@
 #include "Board/Board.h"
+#include "Board/Zobrist.h"
+#include "Board/PieceSquareTables.h"
 #include "MovementValidator.h"
 #include "Exceptions/StringFormatException.h"
-#include <cctype>
+#include <algorithm>
 #include <iostream>
-#include <memory>
 
 
 /**
  * Constructs the board from a string representation where each character represents a piece,
- * with '#' representing an empty square.
+ * with '#' representing an empty square. White is to move.
+ * The position key is built here once and then kept up to date by every board change.
+ * Symbols are translated to pieces through a table built at compile time.
  *
  * @param boardString A linear string representation of the board (e.g., "rnbqkbnrpp...").
  */
 Board::Board(const std::string& boardString) {
-	
+
+	m_squares.fill(NO_PIECE);
+
 	// Check if string is the right length (64 squares)
 	if (boardString.length() != 64) {
 		throw StringFormatException("Expected 64 characters, got " + std::to_string(boardString.length()));
@@ -26,79 +31,142 @@ Board::Board(const std::string& boardString) {
 			continue;
 		}
 
-		std::string pieceName = charToPieceName(symbol);
-		bool isBlack = std::islower(symbol);
-		std::string position = indexToPosition(i);
+		PieceCode piece = pieceFromSymbol(symbol);
+		Square position = static_cast<Square>(i);
 
-		m_board[position] = PieceFactory::createPiece(pieceName, position, isBlack);
+		if (piece != NO_PIECE) {
+			m_squares[position] = piece;
+			addToIndexes(piece, position);
+		}
 	}
 }
 
 
-/**
- * Copy constructor that creates a deep copy of another board.
- *
- * @param other The board to copy from.
- */
-Board::Board(const Board& other){
+ /**
+  * Adds a piece to the type, color and occupancy bitboards, to the position key,
+  * to the evaluation sums and to the end of its color's piece list.
+  *
+  * @param piece The piece being added.
+  * @param square The square the piece occupies.
+  */
+ void Board::addToIndexes(PieceCode piece, Square square) {
 
-	for (const auto& [pos, piece] : other.m_board) {
-		if (piece) {
-			m_board[pos] = piece->clone();
-		}
+	bool isBlack = isBlackPiece(piece);
+	Bitboard mask = squareMask(square);
+	m_pieceMasks[isBlack][static_cast<int>(pieceType(piece))] |= mask;
+	m_colorMasks[isBlack] |= mask;
+	m_occupied |= mask;
+	m_hash ^= zobristPieceKey(isBlack, pieceType(piece), square);
+	addToScores(piece, square, 1);
+
+	m_listIndex[square] = m_pieceCounts[isBlack];
+	m_pieceLists[isBlack][m_pieceCounts[isBlack]++] = square;
+
+	if (pieceType(piece) == PieceType::King) {
+		updateKingSquare(isBlack);
 	}
 }
-	
 
 
  /**
-  * Converts a character to the corresponding piece name.
+  * Removes a piece from the type, color and occupancy bitboards, from the position key,
+  * from the evaluation sums and from its color's piece list. The last list entry fills the freed slot.
   *
-  * @param symbol A character representing the piece.
-  * @return A string representing the piece type.
+  * @param piece The piece being removed.
+  * @param square The square the piece occupied.
   */
- std::string Board::charToPieceName(char symbol) const {
+ void Board::removeFromIndexes(PieceCode piece, Square square) {
 
-	switch (std::tolower(symbol))
-	{
-		case 'r': return "Rook";
-		case 'n': return "Knight";
-		case 'b': return "Bishop";
-		case 'k': return "King";
-		case 'q': return "Queen";
-		case 'p': return "Pawn";
-		default: return "";
+	bool isBlack = isBlackPiece(piece);
+	Bitboard mask = ~squareMask(square);
+	m_pieceMasks[isBlack][static_cast<int>(pieceType(piece))] &= mask;
+	m_colorMasks[isBlack] &= mask;
+	m_occupied &= mask;
+	m_hash ^= zobristPieceKey(isBlack, pieceType(piece), square);
+	addToScores(piece, square, -1);
+
+	Square last = m_pieceLists[isBlack][--m_pieceCounts[isBlack]];
+	m_pieceLists[isBlack][m_listIndex[square]] = last;
+	m_listIndex[last] = m_listIndex[square];
+
+	if (pieceType(piece) == PieceType::King) {
+		updateKingSquare(isBlack);
 	}
 }
 
 
  /**
-  * Converts a linear board index to standard chess position notation.
+  * Moves a piece between two squares in the bitboards, the position key, the
+  * evaluation sums and its color's piece list. The piece keeps its slot in the list.
   *
-  * @param index The index in the board string.
-  * @return A string representing the position in algebraic notation.
+  * @param piece The piece being moved.
+  * @param from The square the piece leaves.
+  * @param to The empty square the piece lands on.
   */
- std::string Board::indexToPosition(int index) const {
+ void Board::moveInIndexes(PieceCode piece, Square from, Square to) {
+
+	bool isBlack = isBlackPiece(piece);
+	Bitboard fromTo = squareMask(from) | squareMask(to);
+	m_pieceMasks[isBlack][static_cast<int>(pieceType(piece))] ^= fromTo;
+	m_colorMasks[isBlack] ^= fromTo;
+	m_occupied ^= fromTo;
+	m_hash ^= zobristPieceKey(isBlack, pieceType(piece), from) ^ zobristPieceKey(isBlack, pieceType(piece), to);
+	addToScores(piece, from, -1);
+	addToScores(piece, to, 1);
 
-	char row = 'a' + index / 8;
-	char col = '1' + index % 8;
-	return { row, col };
+	m_listIndex[to] = m_listIndex[from];
+	m_pieceLists[isBlack][m_listIndex[to]] = to;
+
+	if (pieceType(piece) == PieceType::King) {
+		updateKingSquare(isBlack);
+	}
 }
 
 
  /**
-  * Retrieves the piece at a specific board position.
+  * Adds or subtracts a piece's share of the material, piece-square and phase sums.
+  * Material and phase cancel out when a piece moves, only the table terms change.
   *
-  * @param position The position to check.
-  * @return A raw pointer to the piece at that position, or nullptr if empty.
+  * @param piece The piece being added or removed.
+  * @param square The square the piece stands on.
+  * @param sign 1 to add the piece, -1 to remove it.
   */
- Piece* Board::getPieceAt(const std::string& position) const {
+ void Board::addToScores(PieceCode piece, Square square, int sign) {
+
+	bool isBlack = isBlackPiece(piece);
+	int type = static_cast<int>(pieceType(piece));
+	int index = pieceSquareIndex(isBlack, square);
 
-	auto it = m_board.find(position);
-	if (it == m_board.end()) {
-		return nullptr;
+	// kings are never traded, they don't count as material
+	if (pieceType(piece) != PieceType::King) {
+		m_material[isBlack] += sign * PIECE_VALUES[type];
 	}
-	return it->second.get();
+	m_middlegameScores[isBlack] += sign * MIDDLEGAME_TABLES[type][index];
+	m_endgameScores[isBlack] += sign * ENDGAME_TABLES[type][index];
+	m_phase += sign * PHASE_WEIGHTS[type];
+}
+
+
+ /**
+  * Refreshes the cached king square of one color from its king bitboard.
+  *
+  * @param isBlack True for the black king, false for white.
+  */
+ void Board::updateKingSquare(bool isBlack) {
+
+	Bitboard kings = m_pieceMasks[isBlack][static_cast<int>(PieceType::King)];
+	m_kingSquares[isBlack] = kings ? lowestSquare(kings) : NO_SQUARE;
+}
+
+
+ /**
+  * Retrieves the piece at a specific board position.
+  *
+  * @param position The square to check.
+  * @return The code of the piece at that position, or NO_PIECE if empty.
+  */
+ PieceCode Board::getPieceAt(Square position) const {
+	return m_squares[position];
 }
 
 
@@ -106,36 +174,89 @@ Board::Board(const Board& other){
   * Finds the position of the King for a specific color.
   *
   * @param isBlack True if searching for the black king, false for white.
-  * @return The position of the king, or an empty string if not found.
+  * @return The position of the king, or NO_SQUARE if not found.
   */
- std::string Board::findKingPosition(bool isBlack) const {
-	for (const auto& [position, piece] : m_board)
-	{
-		if (piece && piece->getName() == "King" && piece->isBlack() == isBlack)
-		{
-			return position;
-		}
-	}
+ Square Board::findKingPosition(bool isBlack) const {
+	return m_kingSquares[isBlack];
+}
+
 
-	// if the king isn't on the board
-	return "";
+ /**
+  * Returns the squares occupied by one color's pieces, in no particular order.
+  *
+  * @param isBlack True for black pieces, false for white.
+  * @return A view of the color's piece list, valid until the board changes.
+  */
+ std::span<const Square> Board::getPieceList(bool isBlack) const {
+	return { m_pieceLists[isBlack].data(), m_pieceCounts[isBlack] };
 }
 
 
 
  /**
-  * Moves a piece from its current position to the specified destination.
+  * Makes a move in place, passes the turn, and returns what is needed to take it back.
+  * A piece standing on the destination is removed from the board and kept in the
+  * undo record.
+  *
+  * @param from The square of the piece to move.
+  * @param to The destination square.
+  * @return The undo record to pass to unmakeMove.
+  */
+ UndoRecord Board::makeMove(Square from, Square to) {
+
+	UndoRecord undo;
+	undo.from = from;
+	undo.to = to;
+
+	if (m_squares[to] != NO_PIECE) {
+		removeFromIndexes(m_squares[to], to);
+		undo.captured = m_squares[to];
+	}
+
+	PieceCode piece = m_squares[from];
+	m_squares[to] = piece;
+	m_squares[from] = NO_PIECE;
+	moveInIndexes(piece, from, to);
+	setBlackTurn(!m_isBlackTurn);
+
+	return undo;
+}
+
+
+ /**
+  * Takes back a move made with makeMove, restoring any captured piece.
+  * Moves must be taken back in the reverse order they were made.
   *
-  * @param piece Pointer to the piece to be moved.
-  * @param to The destination position.
+  * @param undo The record returned by the matching makeMove call.
+  */
+ void Board::unmakeMove(UndoRecord& undo) {
+
+	PieceCode piece = m_squares[undo.to];
+	m_squares[undo.from] = piece;
+	m_squares[undo.to] = undo.captured;
+	moveInIndexes(piece, undo.to, undo.from);
+
+	if (undo.captured != NO_PIECE) {
+		addToIndexes(undo.captured, undo.to);
+	}
+	setBlackTurn(!m_isBlackTurn);
+}
+
+
+ /**
+  * Passes the turn without moving a piece. Only meaningful inside a search,
+  * where it is taken back with unmakeNullMove.
   */
- void Board::movePiece(Piece* piece, const std::string& to) {
+ void Board::makeNullMove() {
+	setBlackTurn(!m_isBlackTurn);
+}
 
-	std::string from = piece->getPosition();
-	m_board[to] = std::move(m_board[from]);
-	m_board.erase(from);
-	piece->move(to);
 
+ /**
+  * Takes back a null move made with makeNullMove.
+  */
+ void Board::unmakeNullMove() {
+	setBlackTurn(!m_isBlackTurn);
 }
 
 
@@ -143,40 +264,138 @@ Board::Board(const Board& other){
   * Removes a piece from the specified position on the board.
   *
   * @param position The position to remove the piece from.
-  * @return A raw pointer to the removed piece, or nullptr if no piece was present.
+  * @return The code of the removed piece, or NO_PIECE if no piece was present.
   */
- Piece* Board::removePieceAt(const std::string& position) {
+ PieceCode Board::removePieceAt(Square position) {
 	
-	 auto it = m_board.find(position);
-	if (it != m_board.end()) {
-		Piece* rawPointer = it->second.release();
-		m_board.erase(it);
-		return rawPointer;
+	PieceCode piece = m_squares[position];
+	if (piece != NO_PIECE) {
+		removeFromIndexes(piece, position);
+		m_squares[position] = NO_PIECE;
 	}
-	return nullptr;
+	return piece;
 }
 
 
  /**
   * Places a given piece on the board at the specified position.
   *
-  * @param piece Pointer to the piece to place.
+  * @param piece The code of the piece to place, replacing any piece already there.
   * @param position The position to place the piece at.
   */
- void Board::placePiece(Piece* piece, const std::string& position){
+ void Board::placePiece(PieceCode piece, Square position){
 	
-	 if (piece) {
-		piece->move(position);
-		m_board[position] = std::unique_ptr<Piece>(piece);
+	 if (piece != NO_PIECE) {
+		removePieceAt(position);
+		m_squares[position] = piece;
+		addToIndexes(piece, position);
 	}
 }
 
 
  /**
- * Returns the current state of the board.
- *
- * @return A constant reference to the board map.
- */
- const std::unordered_map<std::string, std::unique_ptr<Piece>>& Board::getBoard() const {
-	return m_board;
+  * Returns the squares occupied by pieces of a given type and color.
+  *
+  * @param type The type of the pieces.
+  * @param isBlack True for black pieces, false for white.
+  * @return A bitboard of the matching squares.
+  */
+ Bitboard Board::getPieces(PieceType type, bool isBlack) const {
+	return m_pieceMasks[isBlack][static_cast<int>(type)];
+}
+
+
+ /**
+  * Returns the squares occupied by pieces of a given color.
+  *
+  * @param isBlack True for black pieces, false for white.
+  * @return A bitboard of the occupied squares.
+  */
+ Bitboard Board::getOccupancy(bool isBlack) const {
+	return m_colorMasks[isBlack];
+}
+
+
+ /**
+  * Returns all occupied squares on the board.
+  *
+  * @return A bitboard of the occupied squares.
+  */
+ Bitboard Board::getOccupancy() const {
+	return m_occupied;
+}
+
+
+ /**
+  * Returns the Zobrist key of the current position.
+  * The key covers piece placement and the side to move.
+  *
+  * @return The 64-bit position key.
+  */
+ std::uint64_t Board::getHash() const {
+	return m_hash;
+}
+
+
+ /**
+  * Checks whether black is the side to move.
+  *
+  * @return True if it's black's turn, false for white.
+  */
+ bool Board::isBlackTurn() const {
+	return m_isBlackTurn;
+}
+
+
+ /**
+  * Sets the side to move, updating the position key.
+  *
+  * @param isBlackTurn True if it's black's turn, false for white.
+  */
+ void Board::setBlackTurn(bool isBlackTurn) {
+
+	if (m_isBlackTurn != isBlackTurn) {
+		m_hash ^= ZOBRIST_KEYS.blackToMove;
+		m_isBlackTurn = isBlackTurn;
+	}
+}
+
+
+ /**
+  * Returns the total value of one color's pieces, kept up to date by every board change.
+  *
+  * @param isBlack True for black pieces, false for white.
+  * @return The material in centipawns.
+  */
+ int Board::getMaterial(bool isBlack) const {
+	return m_material[isBlack];
+}
+
+
+ /**
+  * Returns how far the game is from the endgame, measured by the knights, bishops,
+  * rooks and queens left on the board.
+  *
+  * @return The phase, from 0 for pawns and kings only up to MAX_PHASE.
+  */
+ int Board::getPhase() const {
+	return std::min(m_phase, MAX_PHASE);
+}
+
+
+ /**
+  * Evaluates the position from its running sums, without looking at the pieces: the
+  * material balance plus the piece-square terms, blended between their middlegame
+  * and endgame values by the game phase.
+  *
+  * @return The evaluation in centipawns from white's point of view.
+  */
+ int Board::getEvaluation() const {
+
+	int material = m_material[false] - m_material[true];
+	int middlegame = m_middlegameScores[false] - m_middlegameScores[true];
+	int endgame = m_endgameScores[false] - m_endgameScores[true];
+	int phase = getPhase();
+
+	return material + (middlegame * phase + endgame * (MAX_PHASE - phase)) / MAX_PHASE;
 }
@@ -0,0 +1,36 @@
+#include "Board/Square.h"
+
+
+/**
+ * Converts a square index to standard chess position notation.
+ *
+ * @param square The square index.
+ * @return A string representing the position in algebraic notation (e.g., "e4").
+ */
+std::string squareToPosition(Square square) {
+
+	char row = 'a' + squareRow(square);
+	char col = '1' + squareCol(square);
+	return { row, col };
+}
+
+
+/**
+ * Converts standard chess position notation to a square index.
+ *
+ * @param position The position in algebraic notation (e.g., "e4").
+ * @return The square index, or NO_SQUARE if the position is not on the board.
+ */
+Square positionToSquare(const std::string& position) {
+
+	if (position.size() != 2) {
+		return NO_SQUARE;
+	}
+
+	int row = position[0] - 'a';
+	int col = position[1] - '1';
+	if (!isOnBoard(row, col)) {
+		return NO_SQUARE;
+	}
+	return makeSquare(row, col);
+}
@@ -1,46 +1,67 @@
 #include "Factory/PieceFactory.h"
+#include "Pieces/Pawn.h"
+#include "Pieces/Knight.h"
+#include "Pieces/Bishop.h"
+#include "Pieces/Rook.h"
+#include "Pieces/Queen.h"
+#include "Pieces/King.h"
 
 
 /**
- * Retrieves the static registry that maps piece names to their corresponding creation functions.
+ * Creates a piece of a concrete class.
  *
- * @return A reference to the static unordered_map that holds the mapping of piece names
- *         to their corresponding creation functions (PieceCreator).
+ * @tparam T The piece class to create.
+ * @param position The square of the piece on the board.
+ * @param isBlack A boolean indicating whether the piece is black (true) or white (false).
+ * @return A unique pointer to the created piece.
  */
-std::unordered_map<std::string, PieceFactory::PieceCreator>& PieceFactory::getRegistry() {
-    static std::unordered_map<std::string, PieceCreator> registry;
-    return registry;
+template <typename T>
+std::unique_ptr<Piece> makePiece(Square position, bool isBlack) {
+    return std::make_unique<T>(position, isBlack);
 }
 
 
 /**
- * Registers a new piece type with its associated creator function.
+ * The creator of each piece class, indexed by PieceType. The table is constant-initialized,
+ * so it does not depend on the order in which global constructors run.
+ */
+constinit const std::array<PieceFactory::PieceCreator, PIECE_TYPE_COUNT> PieceFactory::m_creators = {
+    &makePiece<Pawn>,
+    &makePiece<Knight>,
+    &makePiece<Bishop>,
+    &makePiece<Rook>,
+    &makePiece<Queen>,
+    &makePiece<King>
+};
+
+
+/**
+ * Creates a new piece instance from its board-string symbol.
  *
- * @param name The name of the piece type (e.g., "pawn", "queen").
- * @param creator The PieceCreator function that creates the piece.
+ * @param symbol The symbol of the piece, uppercase for white and lowercase for black (e.g., 'N', 'q').
+ * @param position The square of the piece on the board.
  *
- * @return A boolean indicating whether the registration was successful (always returns true).
+ * @return A unique pointer to the created Piece, or nullptr if the symbol is not a piece.
  */
-bool PieceFactory::registerPiece(const std::string& name, PieceCreator creator) {
-    getRegistry().emplace(name, creator);
-    return true;
+std::unique_ptr<Piece> PieceFactory::createPiece(char symbol, Square position) {
+
+    PieceCode piece = pieceFromSymbol(symbol);
+    if (piece == NO_PIECE) {
+        return nullptr;
+    }
+    return m_creators[static_cast<int>(pieceType(piece))](position, isBlackPiece(piece));
 }
 
 
 /**
- * Creates a new piece instance based on the provided name and attributes.
+ * Creates a new piece instance of the given type and color.
  *
- * @param name The name of the piece type to create (e.g., "pawn", "queen").
- * @param position The position of the piece on the board (usually represented as a string, e.g., "A1").
+ * @param type The type of the piece to create.
+ * @param position The square of the piece on the board.
  * @param isBlack A boolean indicating whether the piece is black (true) or white (false).
  *
- * @return A unique pointer to the created Piece if the piece type exists in the registry,
- *         otherwise, returns nullptr if the piece name is not found.
+ * @return A unique pointer to the created Piece.
  */
-std::unique_ptr<Piece> PieceFactory::createPiece(const std::string& name, const std::string& position, bool isBlack) {
-    auto it = getRegistry().find(name);
-    if (it == getRegistry().end()) {
-        return nullptr;
-    }
-    return it->second(position, isBlack);
+std::unique_ptr<Piece> PieceFactory::createPiece(PieceType type, Square position, bool isBlack) {
+    return m_creators[static_cast<int>(type)](position, isBlack);
 }
@@ -1,6 +1,7 @@
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <algorithm>
 #include "GameController.h"
 #include "MoveResult.h"
 
@@ -8,11 +9,24 @@
 /**
  * Constructs a new GameController with the given board layout string.
  * White starts the game by default (m_isBlackTurn = false).
+ * Recommendations search up to the wanted depth, with no time or node budget.
  *
  * @param boardString A linear board representation used to initialize the game.
+ * @param wantedDepth The deepest search iteration for recommendations.
  */
 GameController::GameController (const std::string& boardString, int wantedDepth)
-	: m_board(boardString), m_isBlackTurn(false), m_depth(wantedDepth), m_recommendMoves(m_movementValidator) {}
+	: m_board(boardString), m_isBlackTurn(false), m_recommendMoves(m_movementValidator) {
+
+	m_searchLimits.depth = wantedDepth;
+}
+
+
+/**
+ * Stops a background search still running, so its thread never outlives the controller.
+ */
+GameController::~GameController() {
+	stopPondering();
+}
 
 
 /**
@@ -44,22 +58,24 @@ void GameController::updateIsBlackTurn(bool isBlackTurn) {
  */
 MoveResult GameController::validateMovement(const std::string& response)
 {
-	std::string from = response.substr(0, 2);
-	std::string target = response.substr(2, 2);
+	// positions are parsed once here, the engine works on square indices only
+	Square from = positionToSquare(response.substr(0, 2));
+	Square target = positionToSquare(response.substr(2, 2));
+	if (from == NO_SQUARE || target == NO_SQUARE) return MoveResult::InvalidMoveOrBlocked;
 
-	Piece* piece = m_board.getPieceAt(from);
-	const Piece* targetPiece = m_board.getPieceAt(target);
+	PieceCode piece = m_board.getPieceAt(from);
+	PieceCode targetPiece = m_board.getPieceAt(target);
 
 	if (!isValidSource(piece)) return MoveResult::NoPieceAtSource;
 	if (!isMyPiece(piece)) return MoveResult::OpponentPieceAtSource;
 	if (isSameColorAtTarget(piece, targetPiece)) return  MoveResult::PlayerPieceAtTarget;
-	if (!canLegallyMove(piece, target)) return  MoveResult::InvalidMoveOrBlocked;
+	if (!canLegallyMove(from, target)) return  MoveResult::InvalidMoveOrBlocked;
 	if (doesMoveCauseSelfCheck(piece, from, target)) return MoveResult::MoveCausesCheck;
 
-	m_board.movePiece(piece, target);
-	updateIsBlackTurn(!piece->isBlack());
+	m_board.makeMove(from, target);
+	updateIsBlackTurn(!isBlackPiece(piece));
 
-	bool isOpponentInCheck = isKingInCheck(!piece->isBlack());
+	bool isOpponentInCheck = isKingInCheck(!isBlackPiece(piece));
 	return isOpponentInCheck ? MoveResult::ValidMoveCausesCheck : MoveResult::ValidMove;
 }
 
@@ -67,11 +83,11 @@ MoveResult GameController::validateMovement(const std::string& response)
 /**
  * Determines if a source square has a piece.
  *
- * @param piece Pointer to the piece at the source position.
+ * @param piece The piece at the source position.
  * @return True if a piece exists; otherwise, false.
  */
-bool GameController::isValidSource(Piece* piece) const {
-	if (!piece) {
+bool GameController::isValidSource(PieceCode piece) const {
+	if (piece == NO_PIECE) {
 		return false;
 	}
 	return true;
@@ -81,11 +97,11 @@ bool GameController::isValidSource(Piece* piece) const {
 /**
  * Checks whether the piece belongs to the current player.
  *
- * @param piece Pointer to the piece being moved.
+ * @param piece The piece being moved.
  * @return True if the piece belongs to the current player; otherwise, false.
  */
-bool GameController::isMyPiece(Piece* piece) const {
-	if (isCurrentPlayerBlack() != piece->isBlack()) {
+bool GameController::isMyPiece(PieceCode piece) const {
+	if (isCurrentPlayerBlack() != isBlackPiece(piece)) {
 		return false;
 	}
 	return true;
@@ -95,49 +111,45 @@ bool GameController::isMyPiece(Piece* piece) const {
 /**
  * Validates if the move is legal for the given piece type and path.
  *
- * @param piece Pointer to the piece being moved.
+ * @param from The square of the piece being moved.
  * @param target The destination square.
  * @return True if the move is valid; otherwise, false.
  */
-bool GameController::canLegallyMove(Piece* piece, const std::string& target) {
+bool GameController::canLegallyMove(Square from, Square target) {
 
-	return m_movementValidator.isMoveLegal(piece, target, m_board.getBoard());
+	return m_movementValidator.isMoveLegal(from, target, m_board);
 }
 
 
 /**
  * Determines if a piece at the destination square is the same color as the moving piece.
  *
- * @param piece Pointer to the piece being moved.
- * @param targetPiece Pointer to the piece at the destination square.
+ * @param piece The piece being moved.
+ * @param targetPiece The piece at the destination square, or NO_PIECE if empty.
  * @return True if both pieces are of the same color; otherwise, false.
  */
-bool GameController::isSameColorAtTarget(Piece* piece, const Piece* targetPiece) const {
+bool GameController::isSameColorAtTarget(PieceCode piece, PieceCode targetPiece) const {
 	
-	return (targetPiece && targetPiece->isBlack() == piece->isBlack());
+	return (targetPiece != NO_PIECE && isBlackPiece(targetPiece) == isBlackPiece(piece));
 }
 
 
 /**
  * Simulates the move to check if it would leave the player's own king in check.
  *
- * @param piece Pointer to the piece to move.
+ * @param piece The piece to move.
  * @param from Original position of the piece.
  * @param to Target position of the piece.
  * @return True if the move would result in a check against the player; otherwise, false.
  */
-bool GameController::doesMoveCauseSelfCheck(Piece* piece, const std::string& from, const std::string& to) {
+bool GameController::doesMoveCauseSelfCheck(PieceCode piece, Square from, Square to) {
 
-	Piece* capturedPiece = m_board.removePieceAt(to);
-	m_board.movePiece(piece, to);
+	UndoRecord undo = m_board.makeMove(from, to);
 
-	bool isInSelfCheck = isKingInCheck(piece->isBlack());
+	bool isInSelfCheck = isKingInCheck(isBlackPiece(piece));
 
-	// Undo move
-	m_board.movePiece(piece, from);
-	if (capturedPiece != nullptr){
-		m_board.placePiece(capturedPiece, to); // Restore captured piece
-	}
+	// Undo move, restoring any captured piece
+	m_board.unmakeMove(undo);
 	return isInSelfCheck;
 }
 
@@ -150,20 +162,171 @@ bool GameController::doesMoveCauseSelfCheck(Piece* piece, const std::string& fro
  */
 bool GameController::isKingInCheck(bool kingColor) const {
 	
-	std::string kingPosition = m_board.findKingPosition(kingColor);
-	return m_movementValidator.isKingInCheck(kingColor, kingPosition, m_board.getBoard());
+	Square kingPosition = m_board.findKingPosition(kingColor);
+	return m_movementValidator.isKingInCheck(kingColor, kingPosition, m_board);
 }
 
 
 /**
  * Generates and returns recommended moves for the current player.
+ * A position already searched while pondering, or for the last recommendation,
+ * is answered from the stored result without searching again.
  *
  * @return A priority queue containing the best possible moves.
  */
 PriorityQueue<PossibleMovement> GameController::recommendMoves() {
 	
-	m_recommendMoves.findPossibleMoves(m_depth, m_isBlackTurn, m_board);
-	return m_recommendMoves.getBestMoves();
+	// the board's key tracks the side to move along with the pieces
+	std::uint64_t key = m_board.getHash();
+	auto stored = m_ponderResults.find(key);
+	if (stored != m_ponderResults.end()) {
+		m_recommendations = stored->second;
+	}
+	else {
+		m_recommendMoves.findPossibleMoves(m_searchLimits, m_isBlackTurn, m_board);
+		m_recommendations = m_recommendMoves.getBestMoves();
+	}
+
+	m_ponderResults.clear();
+	m_ponderResults[key] = m_recommendations;
+	return m_recommendations;
+}
+
+
+/**
+ * Allows or forbids searching in the background while the player thinks.
+ *
+ * @param isEnabled True to let startPondering search.
+ */
+void GameController::setPondering(bool isEnabled) {
+	m_isPonderingEnabled = isEnabled;
+}
+
+
+/**
+ * Starts searching, on a background thread, the positions after the moves just
+ * recommended, the replies the player is most likely to choose. The controller must
+ * not be used again until stopPondering is called.
+ */
+void GameController::startPondering() {
+
+	if (!m_isPonderingEnabled || m_ponderThread.joinable()) {
+		return;
+	}
+
+	m_isPonderCancelled = false;
+	m_isPonderDone = false;
+	m_ponderThread = std::thread(&GameController::ponder, this, m_board, m_recommendations);
+}
+
+
+/**
+ * Stops the background search and waits for its thread. Replies it finished
+ * searching are kept for recommendMoves; the shared transposition table keeps
+ * the rest of its work.
+ */
+void GameController::stopPondering() {
+
+	if (!m_ponderThread.joinable()) {
+		return;
+	}
+
+	// a search clears stop requests when it starts, so keep asking until the thread is done
+	m_isPonderCancelled = true;
+	while (!m_isPonderDone) {
+		m_recommendMoves.stop();
+		std::this_thread::yield();
+	}
+	m_ponderThread.join();
+}
+
+
+/**
+ * Background search of the replies to the current position, best first. Each reply's
+ * recommendations are stored under the key of the position it leads to, unless
+ * pondering was cancelled before the search finished.
+ *
+ * @param board A copy of the current position.
+ * @param replies The moves recommended for the current position.
+ */
+void GameController::ponder(Board board, PriorityQueue<PossibleMovement> replies) {
+
+	for (const PossibleMovement& reply : replies.getQueue()) {
+		if (m_isPonderCancelled) {
+			break;
+		}
+
+		Board child(board);
+		child.makeMove(reply.getMove().getFrom(), reply.getMove().getTo());
+		m_recommendMoves.findPossibleMoves(m_searchLimits, child.isBlackTurn(), child);
+
+		if (m_isPonderCancelled) {
+			break;
+		}
+		m_ponderResults[child.getHash()] = m_recommendMoves.getBestMoves();
+	}
+	m_isPonderDone = true;
+}
+
+
+/**
+ * Limits the wall-clock time of each recommendation. The search returns the best moves
+ * of the deepest iteration it finished within the budget.
+ *
+ * @param milliseconds The time budget, 0 for no limit.
+ */
+void GameController::setTimeLimit(std::int64_t milliseconds) {
+	m_searchLimits.timeMs = milliseconds;
+}
+
+
+/**
+ * Limits the number of positions searched for each recommendation.
+ *
+ * @param nodes The node budget, 0 for no limit.
+ */
+void GameController::setNodeLimit(std::uint64_t nodes) {
+	m_searchLimits.nodes = nodes;
+}
+
+
+/**
+ * Switches the selective search techniques used for recommendations on or off.
+ *
+ * @param options The techniques to use.
+ */
+void GameController::setSearchOptions(const SearchOptions& options) {
+	m_recommendMoves.setSearchOptions(options);
+}
+
+
+/**
+ * Sets how many threads search each recommendation.
+ *
+ * @param threadCount The number of threads; values below 1 use one thread.
+ */
+void GameController::setThreadCount(int threadCount) {
+	m_recommendMoves.setThreadCount(std::max(1, threadCount));
+}
+
+
+/**
+ * Sets how the threads of a recommendation search divide the work.
+ *
+ * @param mode Root splitting, Lazy SMP or work stealing.
+ */
+void GameController::setParallelMode(ParallelMode mode) {
+	m_recommendMoves.setParallelMode(mode);
+}
+
+
+/**
+ * Sets the memory used to remember searched positions between recommendations.
+ *
+ * @param sizeInMB The transposition table size in megabytes.
+ */
+void GameController::setHashSize(std::size_t sizeInMB) {
+	m_recommendMoves.setHashSize(sizeInMB);
 }
 
 
@@ -1,66 +1,65 @@
 #include "MovementValidator.h"
+#include "Board/Attacks.h"
 #include <iostream>
 
 
 
 /**
- * Validates whether a move for the given piece to the target position is legal.
+ * Validates whether a move for the piece on the given square to the target position is legal.
  * Checks both the directional validity (according to piece rules)
  * and whether the path is clear of obstructions.
  *
- * @param piece Pointer to the piece being moved.
+ * @param from The square of the piece being moved.
  * @param targetPosition Target destination on the board.
  * @param board Current state of the board with all active pieces.
  * @return True if the move is legal; otherwise, false.
  */
-bool MovementValidator::isMoveLegal(const Piece* piece, const std::string& targetPosition, const BoardMap& board) const {
+bool MovementValidator::isMoveLegal(Square from, Square targetPosition, const Board& board) const {
     
-    if (!piece->isDirectionValid(targetPosition)) {
+    PieceCode piece = board.getPieceAt(from);
+    if (piece == NO_PIECE || !isDirectionValid(piece, from, targetPosition)) {
         return false;
     }
 
-    // special handeling for pawn
-    if (piece->getName() == "Pawn") {
-        return isPawnMoveLegal(piece, targetPosition, board);
-    }
-    else if (piece->getName() == "Knight") {
-        // Knights can jump over pieces; only direction matters
-        return true;
-    }
-    else {
-        return isPathClear(piece, targetPosition, board);
+    switch (pieceType(piece))
+    {
+        // special handeling for pawn
+        case PieceType::Pawn: return isPawnMoveLegal(piece, from, targetPosition, board);
+
+        // Knights jump over pieces and kings move a single square; only direction matters
+        case PieceType::Knight:
+        case PieceType::King: return true;
+
+        default: return isPathClear(from, targetPosition, board);
     }
 }
 
 
 /**
- * Checks if the path between the piece's current position and the target position is clear.
- * Skips this check for King (1-square range).
+ * Checks if the path between a sliding piece's position and the target position is clear.
+ * Sliding paths are answered by the magic bitboard attack tables: the target is
+ * reachable exactly when it lies in the attack set.
  *
- * @param piece Pointer to the piece being moved.
+ * @param start The square of the piece being moved.
  * @param targetPosition Target square.
- * @param board The board map with current pieces.
+ * @param board The board with current pieces.
  * @return True if path is unobstructed; otherwise, false.
  */
-bool MovementValidator::isPathClear(const Piece* piece, const std::string& targetPosition, const BoardMap& board) const{
-    
-    std::string pieceName = piece->getName();
-    
-    if (pieceName == "King") {
-        return true;
-    }
+bool MovementValidator::isPathClear(Square start, Square targetPosition, const Board& board) const{
 
-    auto [startRow, startCol] = piece->positionToCoords(piece->getPosition());
-    auto [endRow, endCol] = piece->positionToCoords(targetPosition);
+    int startRow = squareRow(start);
+    int startCol = squareCol(start);
+    int endRow = squareRow(targetPosition);
+    int endCol = squareCol(targetPosition);
 
     // virtical/horizontal path
     if (startRow == endRow || startCol == endCol) {
-        return isStraightPathClear(startRow, startCol, endRow, endCol, board);
+        return rookAttacks(start, board.getOccupancy()) & squareMask(targetPosition);
     }
 
     // diagonal path
     if (std::abs(endRow - startRow) == std::abs(endCol - startCol)) {
-        return isDiagonalPathClear(startRow, startCol, endRow, endCol, board);
+        return bishopAttacks(start, board.getOccupancy()) & squareMask(targetPosition);
     }
 
     // Should never happen for valid pieces
@@ -68,107 +67,23 @@ bool MovementValidator::isPathClear(const Piece* piece, const std::string& targe
 }
 
 
-/**
- * Checks whether the horizontal or vertical path between two coordinates is free of pieces.
- *
- * @param startRow Starting row index.
- * @param startCol Starting column index.
- * @param endRow Ending row index.
- * @param endCol Ending column index.
- * @param board The current board state.
- * @return True if path is clear; otherwise, false.
- */
-bool MovementValidator::isStraightPathClear(int startRow, int startCol, int endRow, int endCol, const BoardMap& board) const {
-
-    if (startRow == endRow) {
-        // Horizontal movement
-        int start = std::min(startCol, endCol) + 1;
-        int end = std::max(startCol, endCol);
-
-        for (int col = start; col < end; col++) {
-            std::string positionToCheck = coordsToPosition(startRow, col);
-            if (board.find(positionToCheck) != board.end()) {
-                return false;
-            }
-        }
-    }
-    else {
-        // Vertical movement
-        int start = std::min(startRow, endRow) + 1;
-        int end = std::max(startRow, endRow);
-
-        for (int row = start; row < end; row++) {
-            std::string positionToCheck = coordsToPosition(row, startCol);
-            if (board.find(positionToCheck) != board.end()) {
-                return false;
-            }
-        }
-    }
-
-    return true;
-}
+bool MovementValidator::isPawnMoveLegal(PieceCode piece, Square from, Square targetPosition, const Board& board) const {
 
-
-/**
- * Checks whether the diagonal path between two coordinates is free of pieces.
- *
- * @param startRow Starting row index.
- * @param startCol Starting column index.
- * @param endRow Ending row index.
- * @param endCol Ending column index.
- * @param board The current board state.
- * @return True if path is clear; otherwise, false.
- */
-bool MovementValidator::isDiagonalPathClear(int startRow, int startCol, int endRow, int endCol, const BoardMap& board) const {
-    
-    int rowDirection = (endRow > startRow) ? 1 : -1;
-    int colDirection = (endCol > startCol) ? 1 : -1;
-
-    int row = startRow + rowDirection;
-    int col = startCol + colDirection;
-
-    while (row != endRow && col != endCol) {
-        std::string positionToCheck = coordsToPosition(row, col);
-        if (board.find(positionToCheck) != board.end()) {
-            return false;
-        }
-        row += rowDirection;
-        col += colDirection;
-    }
-    return true;
-}
-
-
-/**
- * Converts a pair of (row, column) coordinates into a chessboard-style position string.
- *
- * @param row The row index (0 = 'a', 7 = 'h').
- * @param col The column index (0 = '1', 7 = '8').
- * @return A string representing the position (e.g., "e4").
- */
-std::string MovementValidator::coordsToPosition(int row, int col) const {
-    char rowChar = 'a' + row;
-    char colChar = '1' + col;
-    return std::string(1, rowChar) + std::string(1, colChar);
-}
-
-
-bool MovementValidator::isPawnMoveLegal(const Piece* piece, const std::string& targetPosition, const BoardMap& board) const {
-
-    auto [startRow, startCol] = piece->positionToCoords(piece->getPosition());
-    auto [endRow, endCol] = piece->positionToCoords(targetPosition);
+    int startRow = squareRow(from);
+    int startCol = squareCol(from);
+    int endRow = squareRow(targetPosition);
+    int endCol = squareCol(targetPosition);
 
     // check if the movement is diagonal
     if (startCol != endCol) {
         
         // check if there's an opponents piece in target position
-        auto it = board.find(targetPosition);
-        if (it == board.end()) {
+        PieceCode targetPiece = board.getPieceAt(targetPosition);
+        if (targetPiece == NO_PIECE) {
             return false;
         }
 
-        Piece* targetPiece = it->second.get();
-        if (targetPiece->isBlack() == piece->isBlack()) {
+        if (isBlackPiece(targetPiece) == isBlackPiece(piece)) {
             return false;
         }
 
@@ -178,19 +93,18 @@ bool MovementValidator::isPawnMoveLegal(const Piece* piece, const std::string& t
 
     // check foward movement
     // target must be empty in order to allow movement
-    if (board.find(targetPosition) != board.end()) {
+    if (board.getPieceAt(targetPosition) != NO_PIECE) {
         return false;
     }
 
     // If it's a two-square move, all square must be empty
-    int forwardDirection = piece->isBlack() ? -1 : 1;
+    int forwardDirection = isBlackPiece(piece) ? -1 : 1;
 
     if (std::abs(endRow - startRow) == 2) {
         int intermediateRow = startRow + forwardDirection;
-        std::string intermediatePos = coordsToPosition(intermediateRow, startCol);
 
         // if there's a piece in the path, not valid
-        if (board.find(intermediatePos) != board.end()) {
+        if (board.getPieceAt(makeSquare(intermediateRow, startCol)) != NO_PIECE) {
             return false;
         }
     }
@@ -207,35 +121,70 @@ bool MovementValidator::isPawnMoveLegal(const Piece* piece, const std::string& t
  * @param kingColor True for black king, false for white king.
  * @return True if the king is in check; otherwise, false.
  */
-bool MovementValidator::isKingInCheck(bool kingColor, std::string kingPosition, const BoardMap& board) const {
+bool MovementValidator::isKingInCheck(bool kingColor, Square kingPosition, const Board& board) const {
     
     // null - no king exists in this color
-    if (kingPosition == "") {
+    if (kingPosition == NO_SQUARE) {
         std::cout << "no king in this color" << std::endl;
         return false;
     }
 
-    return IsIfOpponentPiecesThreatning(kingColor, kingPosition, board);
+    return isSquareAttacked(kingPosition, !kingColor, board);
 }
 
 /**
- * Checks whether any opposing pieces are threatening a given position.
+ * Checks whether a square is attacked by any piece of the given color.
+ * Instead of asking every opponent piece whether it can reach the square, looks
+ * outward from the square: along knight, king and pawn-capture offsets, and along
+ * the rook and bishop rays up to the first blocker.
  *
- * @param kingColor The color of the king being threatened (true = black, false = white).
- * @param targetPosition The position to check.
- * @return True if any opponent pieces threaten the king if piece is moved to targetPosition, false otherwise.
+ * @param square The square to check.
+ * @param byBlack True to look for black attackers, false for white.
+ * @param board The current board state.
+ * @return True if at least one piece of that color attacks the square, false otherwise.
  */
-bool MovementValidator::IsIfOpponentPiecesThreatning(bool kingColor, std::string targetPosition, const BoardMap& board) const {
+bool MovementValidator::isSquareAttacked(Square square, bool byBlack, const Board& board) const {
+
+    // a pawn attacks the square if a pawn of the other color on the square would attack it back
+    if (PAWN_ATTACKS[!byBlack][square] & board.getPieces(PieceType::Pawn, byBlack)) {
+        return true;
+    }
+    if (KNIGHT_ATTACKS[square] & board.getPieces(PieceType::Knight, byBlack)) {
+        return true;
+    }
+    if (KING_ATTACKS[square] & board.getPieces(PieceType::King, byBlack)) {
+        return true;
+    }
 
-    for (const auto& [position, piece] : board) {
+    Bitboard occupied = board.getOccupancy();
+    Bitboard queens = board.getPieces(PieceType::Queen, byBlack);
 
-        if (piece && piece->isBlack() != kingColor) {
-            if (piece->isDirectionValid(targetPosition)) {
-                if (isMoveLegal(piece.get(), targetPosition, board)) {
-                    return true;
-                }
-            }
-        }
+    if (rookAttacks(square, occupied) & (board.getPieces(PieceType::Rook, byBlack) | queens)) {
+        return true;
     }
-    return false;
-}
\ No newline at end of file
+    return bishopAttacks(square, occupied) & (board.getPieces(PieceType::Bishop, byBlack) | queens);
+}
+
+
+/**
+ * Finds the pieces of the given color that attack a square, looking outward from the
+ * square the same way isSquareAttacked does.
+ *
+ * @param square The square to check.
+ * @param byBlack True to look for black attackers, false for white.
+ * @param board The current board state.
+ * @return The squares of the attackers, indexed by piece type.
+ */
+std::array<Bitboard, PIECE_TYPE_COUNT> MovementValidator::findAttackers(Square square, bool byBlack, const Board& board) const {
+
+    Bitboard occupied = board.getOccupancy();
+    std::array<Bitboard, PIECE_TYPE_COUNT> attackers{};
+
+    attackers[static_cast<int>(PieceType::Pawn)] = PAWN_ATTACKS[!byBlack][square] & board.getPieces(PieceType::Pawn, byBlack);
+    attackers[static_cast<int>(PieceType::Knight)] = KNIGHT_ATTACKS[square] & board.getPieces(PieceType::Knight, byBlack);
+    attackers[static_cast<int>(PieceType::Bishop)] = bishopAttacks(square, occupied) & board.getPieces(PieceType::Bishop, byBlack);
+    attackers[static_cast<int>(PieceType::Rook)] = rookAttacks(square, occupied) & board.getPieces(PieceType::Rook, byBlack);
+    attackers[static_cast<int>(PieceType::Queen)] = queenAttacks(square, occupied) & board.getPieces(PieceType::Queen, byBlack);
+    attackers[static_cast<int>(PieceType::King)] = KING_ATTACKS[square] & board.getPieces(PieceType::King, byBlack);
+    return attackers;
+}
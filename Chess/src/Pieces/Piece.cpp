@@ -1,39 +1,40 @@
 #include "Pieces/Piece.h"
+#include <array>
+
+const std::array<const char*, PIECE_TYPE_COUNT> PIECE_NAMES = { "Pawn", "Knight", "Bishop", "Rook", "Queen", "King" };
 
 
 /**
- * Constructs a Piece with the specified position, color, and name.
+ * Constructs a Piece with the specified position, color, and type.
  *
  * @param position The initial position of the piece on the board.
  * @param isBlack A boolean indicating whether the piece is black (true) or white (false).
- * @param name The name/type of the piece.
+ * @param type The type of the piece as an enum value.
  */
-Piece::Piece(const std::string& position, bool isBlack, const std::string& name)
-	:m_position(position), m_isBlack(isBlack), m_name(name){}
+Piece::Piece(Square position, bool isBlack, PieceType type)
+	:m_code(makePieceCode(type, isBlack)), m_position(position) {}
 
 
 /**
- * Sets the piece's position to the given target position.
- * Assumes that the move has already been validated.
+ * Checks if the direction from the current position to the target position is valid
+ * for the piece's type. The rules are shared with the board representation.
  *
- * @param targetPosition The new position to move the piece to.
+ * @param targetPosition The target position to check.
+ * @return True if the piece can move in that direction, false otherwise.
  */
-void Piece::move(const std::string& targetPosition) {
-	m_position = targetPosition;
+bool Piece::isDirectionValid(Square targetPosition) const {
+	return ::isDirectionValid(m_code, m_position, targetPosition);
 }
 
 
 /**
- * Converts a board position string into a pair of zero-based row and column indices.
+ * Sets the piece's position to the given target position.
+ * Assumes that the move has already been validated.
  *
- * @param position The position on the board in algebraic notation.
- * @return A pair of integers representing (row, column) as zero-based indices.
+ * @param targetPosition The new position to move the piece to.
  */
-std::pair<int, int> Piece::positionToCoords(const std::string& position) const {
-
-	int row = position[0] - 'a';
-	int col = position[1] - '1';
-	return { row,col };
+void Piece::move(Square targetPosition) {
+	m_position = targetPosition;
 }
 
 
@@ -43,7 +44,7 @@ std::pair<int, int> Piece::positionToCoords(const std::string& position) const {
  * @return true if the piece is black, false if it is white.
  */
 bool Piece::isBlack() const {
-	return m_isBlack;
+	return isBlackPiece(m_code);
 }
 
 
@@ -55,15 +56,35 @@ bool Piece::isBlack() const {
  * @return A string representing the name/type of the piece (e.g., "Rook").
  */
 std::string Piece::getName() const {
-	return m_name;
+	return PIECE_NAMES[static_cast<int>(getType())];
+}
+
+
+/**
+ * Gets the type of the piece.
+ *
+ * @return The PieceType enum value of the piece (e.g., PieceType::Rook).
+ */
+PieceType Piece::getType() const {
+	return pieceType(m_code);
+}
+
+
+/**
+ * Gets the compact code of the piece, as stored on the board.
+ *
+ * @return The type and color of the piece as a PieceCode.
+ */
+PieceCode Piece::getCode() const {
+	return m_code;
 }
 
 
 /**
  * Gets the current position of the piece on the board.
  *
- * @return A string representing the piece's position (e.g., "D5").
+ * @return The square index of the piece's position.
  */
-std::string Piece::getPosition() const {
+Square Piece::getPosition() const {
 	return m_position;
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "Pieces/PieceCode.h"
+#include "Board/Attacks.h"
+#include <cstdlib>
+
+
+/**
+ * Checks if the direction from one square to another matches the movement rules
+ * of a piece type, without looking at the other pieces on the board.
+ * Rooks move along rows and columns, bishops along diagonals, queens along both;
+ * knights, kings and pawns use their precomputed step tables, where a pawn may
+ * push forward (two squares from its starting row) or capture diagonally forward.
+ *
+ * @param piece The code of the moving piece.
+ * @param from The square of the piece.
+ * @param to The target square.
+ * @return True if the piece type can move in that direction, false otherwise.
+ */
+bool isDirectionValid(PieceCode piece, Square from, Square to) {
+
+	int rowDistance = std::abs(squareRow(to) - squareRow(from));
+	int colDistance = std::abs(squareCol(to) - squareCol(from));
+	bool isStraight = rowDistance == 0 || colDistance == 0;
+	bool isDiagonal = rowDistance == colDistance;
+
+	switch (pieceType(piece))
+	{
+		case PieceType::Pawn:
+			return (PAWN_PUSHES[isBlackPiece(piece)][from] | PAWN_ATTACKS[isBlackPiece(piece)][from]) & squareMask(to);
+		case PieceType::Knight: return KNIGHT_ATTACKS[from] & squareMask(to);
+		case PieceType::Bishop: return isDiagonal;
+		case PieceType::Rook: return isStraight;
+		case PieceType::Queen: return isStraight || isDiagonal;
+		case PieceType::King: return KING_ATTACKS[from] & squareMask(to);
+		default: return false;
+	}
+}
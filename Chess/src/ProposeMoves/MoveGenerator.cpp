@@ -0,0 +1,130 @@
+#include "ProposeMoves/MoveGenerator.h"
+#include "Board/Attacks.h"
+#include <cstdlib>
+
+
+/**
+ * Generates the pseudo-legal moves of one side: every move that follows the piece's
+ * movement rules and does not land on an own piece. Moves that leave the own king
+ * in check are included. Captures and pawn double pushes are flagged.
+ *
+ * @param board The current board state.
+ * @param isBlack True to generate black's moves, false for white's.
+ * @param moves The list the moves are appended to.
+ */
+void MoveGenerator::generateMoves(const Board& board, bool isBlack, MoveList& moves) const {
+    generateMovesTo(board, isBlack, ~board.getOccupancy(isBlack), moves);
+}
+
+
+/**
+ * Generates the pseudo-legal captures of one side, the only moves quiescence search
+ * looks at.
+ *
+ * @param board The current board state.
+ * @param isBlack True to generate black's captures, false for white's.
+ * @param moves The list the moves are appended to.
+ */
+void MoveGenerator::generateCaptures(const Board& board, bool isBlack, MoveList& moves) const {
+    generateMovesTo(board, isBlack, board.getOccupancy(!isBlack), moves);
+}
+
+
+/**
+ * Returns the squares a piece attacks from a square. Unlike the move targets, a pawn
+ * attacks its two forward diagonals whether or not anything stands there.
+ *
+ * @param piece The piece, which decides the pawn direction.
+ * @param square The square of the piece.
+ * @param occupied The occupied squares on the board.
+ * @return The attacked squares.
+ */
+Bitboard MoveGenerator::attacksFrom(PieceCode piece, Square square, Bitboard occupied) const {
+
+    PieceType type = pieceType(piece);
+    if (type == PieceType::Pawn) {
+        return PAWN_ATTACKS[isBlackPiece(piece)][square];
+    }
+    return pieceAttacks(type, square, occupied);
+}
+
+
+/**
+ * Generates the pseudo-legal moves of one side that land on the given squares.
+ *
+ * @param board The current board state.
+ * @param isBlack True to generate black's moves, false for white's.
+ * @param allowedTargets The squares the moves may land on; must exclude own pieces.
+ * @param moves The list the moves are appended to.
+ */
+void MoveGenerator::generateMovesTo(const Board& board, bool isBlack, Bitboard allowedTargets, MoveList& moves) const {
+
+    Bitboard occupied = board.getOccupancy();
+    Bitboard opponents = board.getOccupancy(!isBlack);
+
+    for (Square from : board.getPieceList(isBlack)) {
+        PieceType type = pieceType(board.getPieceAt(from));
+
+        Bitboard targets = type == PieceType::Pawn
+            ? pawnTargets(from, isBlack, occupied, opponents)
+            : pieceAttacks(type, from, occupied);
+        targets &= allowedTargets;
+
+        while (targets) {
+            Square to = popLowestSquare(targets);
+
+            std::uint16_t flags = (opponents & squareMask(to)) ? Move::CAPTURE_FLAG : 0;
+            if (type == PieceType::Pawn && std::abs(to - from) == 16) {
+                flags |= Move::DOUBLE_PUSH_FLAG;
+            }
+            moves.push(Move(from, to, flags));
+        }
+    }
+}
+
+
+/**
+ * Returns the squares a pawn can move to: pushes onto empty squares (two squares
+ * only when the square in between is empty too) and diagonal captures of opponent pieces.
+ *
+ * @param from The square of the pawn.
+ * @param isBlack The color of the pawn.
+ * @param occupied The occupied squares on the board.
+ * @param opponents The squares occupied by the opponent.
+ * @return The target squares.
+ */
+Bitboard MoveGenerator::pawnTargets(Square from, bool isBlack, Bitboard occupied, Bitboard opponents) const {
+
+    Bitboard targets = PAWN_ATTACKS[isBlack][from] & opponents;
+
+    Bitboard pushes = PAWN_PUSHES[isBlack][from] & ~occupied;
+    Bitboard oneStep = isBlack ? squareMask(from) >> 8 : squareMask(from) << 8;
+
+    // a double push needs the square in between to be empty too
+    if (pushes & oneStep) {
+        targets |= pushes;
+    }
+    return targets;
+}
+
+
+/**
+ * Returns the squares a non-pawn piece attacks from a square.
+ *
+ * @param type The type of the piece.
+ * @param square The square of the piece.
+ * @param occupied The occupied squares on the board.
+ * @return The attacked squares.
+ */
+Bitboard MoveGenerator::pieceAttacks(PieceType type, Square square, Bitboard occupied) const {
+
+    switch (type)
+    {
+        case PieceType::Knight: return KNIGHT_ATTACKS[square];
+        case PieceType::Bishop: return bishopAttacks(square, occupied);
+        case PieceType::Rook: return rookAttacks(square, occupied);
+        case PieceType::Queen: return queenAttacks(square, occupied);
+        case PieceType::King: return KING_ATTACKS[square];
+        default: return 0;
+    }
+}
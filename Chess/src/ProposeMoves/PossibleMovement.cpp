@@ -1,32 +1,36 @@
 #include "ProposeMoves/PossibleMovement.h"
+#include <algorithm>
 
 /**
- * Sets the starting position of the movement.
+ * Sets the move this movement recommends.
  *
- * @param from The starting position.
+ * @param move The recommended move.
  */
-void PossibleMovement::setFrom(const std::string& from) {
-	m_from = from;
+void PossibleMovement::setMove(Move move) {
+	m_move = move;
 }
 
 
 /**
- * Sets the destination position of the movement.
+ * Sets the score for this movement.
  *
- * @param to The destination position.
+ * @param score The score to assign to this movement.
  */
-void PossibleMovement::setDestination(const std::string& to) {
-	m_destination = to;
+void PossibleMovement::setScore(int score) {
+	m_score = score;
 }
 
 
 /**
- * Sets the score for this movement.
+ * Sets the line of play the search expects after this movement, starting with the
+ * movement itself. Moves beyond MAX_LINE_LENGTH are dropped.
  *
- * @param score The score to assign to this movement.
+ * @param line The expected moves, in order.
  */
-void PossibleMovement::setScore(int score) {
-	m_score = score;
+void PossibleMovement::setLine(std::span<const Move> line) {
+
+	m_lineLength = std::min(static_cast<int>(line.size()), MAX_LINE_LENGTH);
+	std::copy_n(line.begin(), m_lineLength, m_line.begin());
 }
 
 
@@ -42,24 +46,24 @@ int PossibleMovement::getScore() const
 
 
 /**
- * Returns the starting position of the movement.
+ * Returns the move this movement recommends.
  *
- * @return A constant reference to the starting position.
+ * @return The recommended move.
  */
-const std::string& PossibleMovement::getFrom() const
+Move PossibleMovement::getMove() const
 {
-	return m_from;
+	return m_move;
 }
 
 
 /**
- * Returns the destination position of the movement.
+ * Returns the line of play the search expects after this movement.
  *
- * @return A constant reference to the destination position.
+ * @return The expected moves, starting with the movement itself.
  */
-const std::string& PossibleMovement::getDestination() const
+std::span<const Move> PossibleMovement::getLine() const
 {
-	return m_destination;
+	return { m_line.data(), static_cast<std::size_t>(m_lineLength) };
 }
 
 
@@ -82,12 +86,22 @@ bool operator>(const PossibleMovement& m1, const PossibleMovement& m2) {
 
 /**
  * Stream insertion operator for PossibleMovement objects.
+ * Moves are converted to algebraic notation only here, when recommendations are rendered.
+ * The expected line follows the move, in the notation the player types moves in.
  *
  * @param os The output stream.
  * @param obj The movement to output.
  * @return The output stream.
  */
 std::ostream& operator<<(std::ostream& os, const PossibleMovement& obj) {
-	os << obj.getFrom() << " -> " << obj.getDestination();
+	os << squareToPosition(obj.getMove().getFrom()) << " -> " << squareToPosition(obj.getMove().getTo());
+
+	std::span<const Move> line = obj.getLine();
+	if (!line.empty()) {
+		os << "  line:";
+		for (Move move : line) {
+			os << ' ' << squareToPosition(move.getFrom()) << squareToPosition(move.getTo());
+		}
+	}
 	return os;
 }
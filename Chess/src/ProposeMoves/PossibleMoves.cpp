@@ -1,19 +1,57 @@
 #include "ProposeMoves/PossibleMoves.h"
 #include "PriorityQueue.h"
-#include <climits>
+#include "Board/PieceSquareTables.h"
 #include <algorithm>
+#include <array>
+#include <thread>
 
-const int PAWN_VALUE = 100;
-const int KNIGHT_VALUE = 320;
-const int BISHOP_VALUE = 330;
-const int ROOK_VALUE = 500;
-const int QUEEN_VALUE = 900;
-const int KING_VALUE = 20000;
+const int PAWN_VALUE = PIECE_VALUES[static_cast<int>(PieceType::Pawn)];
 
 const int THREATENED_BY_WEAKER_PENALTY = -100;
 const int THREATENED_BY_STRONGER_PENALTY = -200;
 const int THREATENS_STRONGER_BONUS = 150;
 const int CAPTURE_BONUS_MULTIPLIER = 10;
+const int CHECKMATE_SCORE = 1000000;
+const int MATERIAL_WEIGHT = CAPTURE_BONUS_MULTIPLIER;	// Evaluations are scored on the scale of the capture bonus
+const int MAX_QUIESCENCE_DEPTH = 8;					// Captures searched past the horizon at most
+const int DELTA_MARGIN = 2 * PAWN_VALUE * MATERIAL_WEIGHT;	// Positional swing a capture may add to its material gain
+const int INFINITE_SCORE = 2 * CHECKMATE_SCORE;	// Beyond any score, including mates
+const int ASPIRATION_WINDOW = 50;					// Half-width of the first window around an expected root score
+const int NODE_CHECK_INTERVAL = 1024;				// Searched positions between budget checks
+const int STABLE_ITERATIONS = 3;					// Iterations with the same best move before stopping early
+
+// Move ordering scores, from the first move tried to the last
+const int HASH_MOVE_ORDER = 4000000;				// Best move stored for the position
+const int CAPTURE_ORDER = 2000000;					// Captures, then by victim and attacker value
+const int VICTIM_ORDER_WEIGHT = 100;				// Victim value counts this much more than attacker value
+const int FIRST_KILLER_ORDER = 900000;				// Quiet moves that caused a cutoff at the same ply
+const int SECOND_KILLER_ORDER = 899999;
+const int COUNTER_MOVE_ORDER = 800000;				// Quiet reply that refuted the opponent's last move
+const int HISTORY_LIMIT = 500000;					// History scores are halved before exceeding this
+
+// Selective search, margins in material scale
+const int MATE_BOUND = CHECKMATE_SCORE - 2 * PossibleMoves::MAX_PLY;	// Scores beyond this are mates
+const int NULL_MOVE_MIN_DEPTH = 3;					// Shallowest depth a null move is tried at
+const int NULL_MOVE_REDUCTION = 2;					// Depth skipped by the null move search, more when deeper
+const int ZUGZWANG_PIECES = 2;						// With this few pieces besides pawns, null-move cutoffs are verified
+const int LMR_MIN_DEPTH = 3;						// Shallowest depth late moves are reduced at
+const int LMR_FULL_MOVES = 3;						// Moves searched at full depth before reducing
+const int LMR_LATE_MOVES = 10;						// Moves after this many are reduced one ply more
+const int LMR_GOOD_HISTORY = 256;					// History score that earns a ply less reduction
+const int FUTILITY_DEPTH = 2;						// Deepest depth futility pruning applies to
+const int FUTILITY_MARGIN = 2 * PAWN_VALUE * MATERIAL_WEIGHT;	// Per ply of depth
+const int REVERSE_FUTILITY_DEPTH = 3;				// Deepest depth reverse futility pruning applies to
+const int REVERSE_FUTILITY_MARGIN = PAWN_VALUE * MATERIAL_WEIGHT;	// Per ply of depth
+const int RAZORING_DEPTH = 2;						// Deepest depth razoring applies to
+const int RAZORING_MARGIN = 3 * PAWN_VALUE * MATERIAL_WEIGHT;		// Per ply of depth
+const int PRUNED_SCORE = -INFINITE_SCORE - 1;		// Returned for a move futility pruning skipped
+
+// Work stealing
+const int SPLIT_MIN_DEPTH = 4;						// Shallowest depth whose moves are shared between threads
+const int TASK_THREAD_SHIFT = 24;
+const int TASK_PLY_SHIFT = 16;
+const std::uint32_t TASK_FIELD_MASK = 0xFF;
+const std::uint32_t TASK_MOVE_MASK = 0xFFFF;
 
 
 
@@ -23,77 +61,172 @@ const int CAPTURE_BONUS_MULTIPLIER = 10;
  * @param movementValidator The validator used to check move legality.
  */
 PossibleMoves::PossibleMoves(const MovementValidator& movementValidator)
-    : m_movementValidator(movementValidator) {}
+    : m_movementValidator(movementValidator), m_transpositionTable(DEFAULT_HASH_SIZE_MB),
+      m_splitPoints(std::make_unique<std::array<SplitPoint, MAX_PLY>>()) {}
+
+
+/**
+ * Resizes the transposition tables used by the search. Stored positions are discarded.
+ * Threads splitting the root share the size between their own tables; in the other
+ * modes all threads use one table of the full size.
+ *
+ * @param sizeInMB The total table size in megabytes.
+ */
+void PossibleMoves::setHashSize(std::size_t sizeInMB) {
+
+    m_hashSizeMB = sizeInMB;
+    bool isShared = m_parallelMode != ParallelMode::RootSplit;
+    std::size_t threadShare = isShared ? sizeInMB : sizeInMB / (m_helpers.size() + 1);
+    m_transpositionTable.resize(threadShare);
+    for (auto& helper : m_helpers) {
+        helper->m_transpositionTable.resize(isShared ? 0 : threadShare);
+    }
+}
+
+
+/**
+ * Sets how many threads search each position. Each thread has its own copy of the
+ * board and its own move ordering tables; how they divide the work is set by
+ * setParallelMode. Stored positions are discarded.
+ *
+ * @param threadCount The number of threads, from 1 to MAX_THREADS.
+ */
+void PossibleMoves::setThreadCount(int threadCount) {
+
+    m_helpers.clear();
+    for (int i = 1; i < std::min(threadCount, MAX_THREADS); ++i) {
+        auto helper = std::make_unique<PossibleMoves>(m_movementValidator);
+        helper->m_stopFlag = &m_stopRequested;
+        helper->m_owner = this;
+        helper->m_threadIndex = i;
+        helper->m_options = m_options;
+        m_helpers.push_back(std::move(helper));
+    }
+    setParallelMode(m_parallelMode);
+}
+
+
+/**
+ * Sets how several threads divide a search. Stored positions are discarded.
+ *
+ * @param mode Root splitting, Lazy SMP or work stealing; the last two share one table.
+ */
+void PossibleMoves::setParallelMode(ParallelMode mode) {
+
+    m_parallelMode = mode;
+    bool isShared = mode != ParallelMode::RootSplit;
+    for (auto& helper : m_helpers) {
+        helper->m_parallelMode = mode;
+        helper->m_table = isShared ? &m_transpositionTable : &helper->m_transpositionTable;
+    }
+    setHashSize(m_hashSizeMB);
+}
+
+
+/**
+ * Chooses the selective techniques used by the following searches.
+ *
+ * @param options The techniques to switch on and off.
+ */
+void PossibleMoves::setSearchOptions(const SearchOptions& options) {
+
+    m_options = options;
+    for (auto& helper : m_helpers) {
+        helper->m_options = options;
+    }
+}
 
 
 /**
  * Returns the point value of a chess piece.
  *
- * @param piece Pointer to the piece to evaluate.
- * @return The point value of the piece, or 0 if piece is null or unknown.
+ * @param piece The code of the piece to evaluate.
+ * @return The point value of the piece, or 0 if there is no piece.
  */
-int PossibleMoves::getPieceValue(const Piece* piece) const {
+int PossibleMoves::getPieceValue(PieceCode piece) const {
     
-    if (!piece) return 0;
-    const std::string& name = piece->getName();
-    if (name == "Pawn") return PAWN_VALUE;
-    if (name == "Knight") return KNIGHT_VALUE;
-    if (name == "Bishop") return BISHOP_VALUE;
-    if (name == "Rook") return ROOK_VALUE;
-    if (name == "Queen") return QUEEN_VALUE;
-    if (name == "King") return KING_VALUE;
-    return 0;
+    if (piece == NO_PIECE) return 0;
+    return PIECE_VALUES[static_cast<int>(pieceType(piece))];
+}
+
+
+/**
+ * Checks whether a side's king is attacked, which makes the move that led here illegal.
+ *
+ * @param board The board state after the move.
+ * @param isBlack The color of the king to check.
+ * @return True if the king is on the board and attacked, false otherwise.
+ */
+bool PossibleMoves::isKingExposed(const Board& board, bool isBlack) const {
+
+    Square kingPosition = board.findKingPosition(isBlack);
+    return kingPosition != NO_SQUARE && m_movementValidator.isSquareAttacked(kingPosition, !isBlack, board);
+}
+
+
+/**
+ * Checks whether a side has nothing but pawns besides its king, where passing the
+ * turn is often the best move and null-move pruning goes wrong.
+ *
+ * @param board The current board state.
+ * @param isBlack The color to check.
+ * @return True if the side has no knight, bishop, rook or queen.
+ */
+bool PossibleMoves::hasOnlyPawns(const Board& board, bool isBlack) const {
+
+    Bitboard pawnsAndKing = board.getPieces(PieceType::Pawn, isBlack) | board.getPieces(PieceType::King, isBlack);
+    return (board.getOccupancy(isBlack) & ~pawnsAndKing) == 0;
+}
+
+
+/**
+ * Checks whether a score announces a checkmate for either side.
+ *
+ * @param score The score as returned by the search.
+ * @return True for a mate score.
+ */
+bool PossibleMoves::isMateScore(int score) const {
+    return score >= MATE_BOUND || score <= -MATE_BOUND;
 }
 
 
 /**
  * Calculates the score for a specific move by evaluating captures, threats, and tactical benefits.
  *
- * @param boardBefore The board state before the move.
- * @param boardAfter The board state after the move.
- * @param from The starting position of the move.
+ * @param board The board state after the move.
+ * @param capturedPiece The piece taken by the move, or NO_PIECE if none.
  * @param to The destination position of the move.
  * @return The calculated score for the move.
  */
-int PossibleMoves::calculateMoveScore(Board& boardBefore, Board& boardAfter, const std::string& from, const std::string& to) {
+int PossibleMoves::calculateMoveScore(const Board& board, PieceCode capturedPiece, Square to) {
        
-    auto movedPiece = boardAfter.getPieceAt(to);
-    if (!movedPiece) {
+    PieceCode movedPiece = board.getPieceAt(to);
+    if (movedPiece == NO_PIECE) {
         return 0;
     }
 
     int score = 0;
 
-    auto capturedPiece = boardBefore.getPieceAt(to);
-    if (capturedPiece && capturedPiece->isBlack() != movedPiece->isBlack()) {
+    if (capturedPiece != NO_PIECE && isBlackPiece(capturedPiece) != isBlackPiece(movedPiece)) {
         int captureValue = getPieceValue(capturedPiece);
         score += captureValue * CAPTURE_BONUS_MULTIPLIER;
     }
 
-    for (const auto& [pos, enemyPiece] : boardAfter.getBoard()) {
-        if (!enemyPiece || enemyPiece->isBlack() == movedPiece->isBlack()) continue;
+    bool isBlack = isBlackPiece(movedPiece);
+    int myValue = getPieceValue(movedPiece);
+    std::array<Bitboard, PIECE_TYPE_COUNT> attackers = m_movementValidator.findAttackers(to, !isBlack, board);
 
-        // Check if this enemy piece can move to the new location of our moved piece
-        if (m_movementValidator.isMoveLegal(enemyPiece.get(), to, boardAfter.getBoard())) {
-            int threatValue = getPieceValue(enemyPiece.get());
-            int myValue = getPieceValue(movedPiece);
-
-            if (threatValue < myValue) {
-                score += THREATENED_BY_WEAKER_PENALTY;
-            }
-            else {
-                score += THREATENED_BY_STRONGER_PENALTY;
-            }
-        }
+    // Every enemy piece that attacks the new square
+    for (int type = 0; type < PIECE_TYPE_COUNT; ++type) {
+        int penalty = PIECE_VALUES[type] < myValue ? THREATENED_BY_WEAKER_PENALTY : THREATENED_BY_STRONGER_PENALTY;
+        score += countSquares(attackers[type]) * penalty;
     }
 
-    for (const auto& [pos, targetPiece] : boardAfter.getBoard()) {
-        if (targetPiece && targetPiece->isBlack() != movedPiece->isBlack()) {
-            if (m_movementValidator.isMoveLegal(movedPiece, pos, boardAfter.getBoard())) {
-                if (getPieceValue(targetPiece.get()) > getPieceValue(movedPiece)) {
-                    score += THREATENS_STRONGER_BONUS;
-                }
-            }
+    // Every more valuable enemy piece the moved piece now attacks
+    Bitboard reach = m_moveGenerator.attacksFrom(movedPiece, to, board.getOccupancy());
+    for (int type = 0; type < PIECE_TYPE_COUNT; ++type) {
+        if (PIECE_VALUES[type] > myValue) {
+            score += countSquares(reach & board.getPieces(static_cast<PieceType>(type), !isBlack)) * THREATENS_STRONGER_BONUS;
         }
     }
     return score;
@@ -101,148 +234,1126 @@ int PossibleMoves::calculateMoveScore(Board& boardBefore, Board& boardAfter, con
 
 
 /**
- * Finds and evaluates all possible moves for a given color using minimax algorithm.
+ * Finds and evaluates all possible moves for a given color, searching to a fixed depth.
  *
- * @param depth The search depth for the minimax algorithm.
+ * @param depth The search depth, in moves after the recommended one.
  * @param isBlack True if finding moves for black pieces, false for white.
  * @param board The current board state to analyze.
  */
-void PossibleMoves::findPossibleMoves(int depth, bool isBlack, const Board& board ) {
+void PossibleMoves::findPossibleMoves(int depth, bool isBlack, const Board& board) {
+
+    SearchLimits limits;
+    limits.depth = depth;
+    findPossibleMoves(limits, isBlack, board);
+}
 
 
+/**
+ * Finds and evaluates all possible moves for a given color by iterative deepening:
+ * the root moves are searched one move deeper each iteration, best moves of the
+ * previous iteration first, until the depth limit is reached or the budget runs out.
+ * The recommendations come from the last iteration that finished.
+ * With several threads splitting the root, each iteration splits the root moves
+ * between them. With Lazy SMP, helper threads deepen over the same root on their own
+ * and only help through the shared table; the recommendations come from this thread.
+ * With work stealing, helper threads take over later moves of nodes this thread
+ * searches, and of nodes they search for it in turn.
+ *
+ * @param limits The depth limit and the time and node budgets of the search.
+ * @param isBlack True if finding moves for black pieces, false for white.
+ * @param board The current board state to analyze.
+ */
+void PossibleMoves::findPossibleMoves(const SearchLimits& limits, bool isBlack, const Board& board) {
+
     // Clear previous best moves
-    while (!m_bestMoves.getQueue().empty()) {
+    while (!m_bestMoves.isEmpty()) {
         m_bestMoves.poll();
     }
 
-    m_recommendForBlack = isBlack;
-    m_isBlackTurn = isBlack;
+    // Splitting the root, every thread searches part of the answer and takes a share of
+    // a node budget. Otherwise the answer comes from this thread alone: it keeps the whole
+    // budget, and the helpers search until it is done
+    SearchLimits ownLimits = limits;
+    SearchLimits helperLimits = limits;
+    if (limits.nodes > 0) {
+        if (m_parallelMode == ParallelMode::RootSplit) {
+            ownLimits.nodes = std::max<std::uint64_t>(1, limits.nodes / (m_helpers.size() + 1));
+            helperLimits.nodes = ownLimits.nodes;
+        }
+        else {
+            helperLimits.nodes = 0;
+        }
+    }
 
+    auto startTime = std::chrono::steady_clock::now();
+    m_stopRequested.store(false, std::memory_order_relaxed);
+    m_transpositionTable.newSearch();
+    startSearch(ownLimits, startTime);
+    for (auto& helper : m_helpers) {
+        helper->m_transpositionTable.newSearch();
+        helper->startSearch(helperLimits, startTime);
+    }
+    int maxDepth = std::clamp(limits.depth, 0, MAX_PLY - 2);
 
-    for (const auto& [pos, piece] : board.getBoard()) {
-        if (piece && piece->isBlack() == m_recommendForBlack) {
-            for (const std::string& target : allPositionsOnBoard()) {
-                if (target == pos) continue;
+    // This thread's only copy of the search: moves are made and taken back in place
+    Board searchBoard(board);
+    searchBoard.setBlackTurn(isBlack);
 
-                auto targetPiece = board.getPieceAt(target);
-                if (targetPiece && (targetPiece->isBlack() == m_isBlackTurn)) continue;
+    MoveList moves;
+    m_moveGenerator.generateMoves(searchBoard, isBlack, moves);
 
-                if (!m_movementValidator.isMoveLegal(piece.get(), target, board.getBoard())) continue;
+    bool isRootSplit = m_parallelMode == ParallelMode::RootSplit && !m_helpers.empty();
+    std::vector<std::thread> helperThreads;
+    m_isSearchDone.store(false, std::memory_order_relaxed);
+    m_rootIteration.generation = 0;
+    for (std::size_t i = 0; i < m_helpers.size(); ++i) {
+        if (isRootSplit) {
+            helperThreads.emplace_back(&PossibleMoves::searchRootAsHelper, m_helpers[i].get());
+        }
+        else if (m_parallelMode == ParallelMode::LazySmp) {
+            helperThreads.emplace_back(&PossibleMoves::searchAsHelper, m_helpers[i].get(), searchBoard, moves, maxDepth, static_cast<int>(i));
+        }
+        else {
+            helperThreads.emplace_back(&PossibleMoves::stealUntilSearchDone, m_helpers[i].get());
+        }
+    }
 
-                // Create a copy of the board to simulate the move
-                Board clonedBoard(board);
-                Piece* clonedPiece = clonedBoard.getPieceAt(pos);
-                if (!clonedPiece) continue;
-                Board beforeBoard(clonedBoard);
-                clonedBoard.movePiece(clonedPiece, target);
-                
-                // Calculate immediate score for this move
-                int immediateScore = calculateMoveScore(beforeBoard, clonedBoard, pos, target);
+    Move previousBest;
+    int stableIterations = 0;
+
+    for (int depth = 0; depth <= maxDepth; ++depth) {
+
+        PriorityQueue<PossibleMovement> iterationMoves;
+        if (!isRootSplit) {
+            std::atomic<int> nextMove = 0;
+            searchRoot(searchBoard, depth, moves, nextMove, iterationMoves);
+        }
+        else {
+            searchRootInParallel(searchBoard, depth, moves, iterationMoves);
+        }
+
+        // an interrupted iteration is incomplete, keep the previous one
+        if (isStopped()) {
+            break;
+        }
+        m_bestMoves = iterationMoves;
+        moves.sortByScore();
+
+        if (m_bestMoves.isEmpty()) {
+            break;
+        }
+
+        Move best = m_bestMoves.getQueue().front().getMove();
+        stableIterations = (best == previousBest) ? stableIterations + 1 : 0;
+        previousBest = best;
+
+        // the next iteration takes several times longer than this one: don't start
+        // it when it can't finish, or when the best move has stopped changing
+        if (isBudgetUsed(2) || (stableIterations >= STABLE_ITERATIONS && isBudgetUsed(4))) {
+            break;
+        }
+    }
+
+    // this thread's result is final, the helpers only have to unwind
+    if (!helperThreads.empty()) {
+        stop();
+        {
+            std::lock_guard<std::mutex> lock(m_rootIteration.mutex);
+            m_isSearchDone.store(true, std::memory_order_release);
+        }
+        m_rootIteration.start.notify_all();
+        for (std::thread& thread : helperThreads) {
+            thread.join();
+        }
+    }
+}
+
+
+/**
+ * Deepens over the root moves like findPossibleMoves, for a Lazy SMP helper thread.
+ * Its results reach the main thread only through the shared transposition table;
+ * every other helper starts one ply deeper, so the threads don't all search the
+ * same iteration at the same time.
+ *
+ * @param board This thread's copy of the root position, taken before the main thread
+ *              starts changing its own.
+ * @param moves This thread's copy of the pseudo-legal root moves.
+ * @param maxDepth The deepest iteration.
+ * @param helperIndex The index of this helper among the helpers.
+ */
+void PossibleMoves::searchAsHelper(Board board, MoveList moves, int maxDepth, int helperIndex) {
+
+    for (int depth = 1 + helperIndex % 2; depth <= maxDepth && !isStopped(); ++depth) {
+        std::atomic<int> nextMove = 0;
+        PriorityQueue<PossibleMovement> iterationMoves;
+        searchRoot(board, depth, moves, nextMove, iterationMoves);
+        moves.sortByScore();
+    }
+}
+
+
+/**
+ * Asks a running search to stop as soon as possible. Safe to call from another thread.
+ */
+void PossibleMoves::stop() {
+    m_stopFlag->store(true, std::memory_order_relaxed);
+}
+
+
+/**
+ * Resets the per-search state of this searcher: budgets, node count and move ordering.
+ *
+ * @param limits The depth limit and the time and node budgets of this searcher.
+ * @param startTime When the search started, shared by all threads of one search.
+ */
+void PossibleMoves::startSearch(const SearchLimits& limits, std::chrono::steady_clock::time_point startTime) {
+
+    m_limits = limits;
+    m_nodes = 0;
+    m_startTime = startTime;
+    resetMoveOrdering();
+}
 
-                // Calculate future score through minMax algorithm
-                int futureScore = 0;
-                if (depth > 0) {
-                    futureScore = minMax(clonedBoard, !m_isBlackTurn, 1, depth);
-                }
 
-                // Final score is immediate + future
-                int finalScore = immediateScore + futureScore;
+/**
+ * Runs one iteration over the root moves on all threads. The helper threads stay
+ * parked between iterations instead of being started for each one: this hands them
+ * the iteration and waits until all of them have finished it. Each thread takes the
+ * next unsearched move from a shared counter and keeps its own best moves, which are
+ * merged afterwards. Each thread orders and prunes with its own table, killers and
+ * history, so which thread searched a move can change its score: the result may
+ * differ from a single thread's unless all selective techniques are disabled.
+ *
+ * @param board The position to search, copied for each thread.
+ * @param depth The search depth below the root moves.
+ * @param moves The pseudo-legal root moves, each thread scores the ones it searched.
+ * @param bestMoves Receives the best moves of this iteration.
+ */
+void PossibleMoves::searchRootInParallel(const Board& board, int depth, MoveList& moves, PriorityQueue<PossibleMovement>& bestMoves) {
+
+    RootIteration& iteration = m_rootIteration;
+    {
+        std::lock_guard<std::mutex> lock(iteration.mutex);
+        iteration.board = &board;
+        iteration.moves = &moves;
+        iteration.depth = depth;
+        iteration.nextMove.store(0, std::memory_order_relaxed);
+        iteration.runningHelpers = static_cast<int>(m_helpers.size());
+        ++iteration.generation;
+    }
+    iteration.start.notify_all();
 
-                // Create movement object and add to priority queue
-                PossibleMovement movement;
-                movement.setFrom(pos);
-                movement.setDestination(target);
-                movement.setScore(finalScore);
-                m_bestMoves.push(movement);
+    Board searchBoard(board);
+    searchRoot(searchBoard, depth, moves, iteration.nextMove, bestMoves);
+
+    std::unique_lock<std::mutex> lock(iteration.mutex);
+    iteration.finish.wait(lock, [&iteration] { return iteration.runningHelpers == 0; });
+    for (const auto& helper : m_helpers) {
+        for (const PossibleMovement& movement : helper->m_bestMoves.getQueue()) {
+            bestMoves.push(movement);
+        }
+    }
+}
+
+
+/**
+ * Searches the root iterations the owner hands out, for a root-splitting helper thread,
+ * until the owner's search is done. The best moves of each iteration are left in this
+ * helper's recommendations for the owner to merge.
+ */
+void PossibleMoves::searchRootAsHelper() {
+
+    RootIteration& iteration = m_owner->m_rootIteration;
+    int searchedGeneration = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(iteration.mutex);
+            iteration.start.wait(lock, [this, &iteration, searchedGeneration] {
+                return iteration.generation != searchedGeneration || m_owner->m_isSearchDone.load(std::memory_order_relaxed);
+            });
+            if (m_owner->m_isSearchDone.load(std::memory_order_relaxed)) {
+                return;
             }
+            searchedGeneration = iteration.generation;
+        }
+
+        Board board(*iteration.board);
+        m_bestMoves = PriorityQueue<PossibleMovement>();
+        searchRoot(board, iteration.depth, *iteration.moves, iteration.nextMove, m_bestMoves);
+
+        std::lock_guard<std::mutex> lock(iteration.mutex);
+        if (--iteration.runningHelpers == 0) {
+            iteration.finish.notify_one();
+        }
+    }
+}
+
+
+/**
+ * Runs one iteration over the root moves: every legal move gets its immediate score
+ * plus the value of the position it leads to. Only the moves that can still enter the
+ * recommendations are searched exactly: the others only have to be proven worse than
+ * the weakest recommendation kept so far. Each move's score is kept in the move list
+ * to order the next iteration. Moves are taken from a counter that other threads may
+ * share, so each one is searched by exactly one thread.
+ *
+ * @param board The search board, at the root position.
+ * @param depth The search depth below the root moves.
+ * @param moves The pseudo-legal root moves.
+ * @param nextMove The index of the next move to search, advanced as moves are taken.
+ * @param bestMoves Receives the best moves of this iteration.
+ */
+void PossibleMoves::searchRoot(Board& board, int depth, MoveList& moves, std::atomic<int>& nextMove, PriorityQueue<PossibleMovement>& bestMoves) {
+
+    bool isBlack = board.isBlackTurn();
+    int rootEvaluation = evaluate(board);
+
+    for (int i = nextMove++; i < moves.size() && !isStopped(); i = nextMove++) {
+        Move move = moves[i];
+
+        // Simulate the move on the search board, skipping moves that leave the king in check
+        UndoRecord undo = board.makeMove(move.getFrom(), move.getTo());
+        if (isKingExposed(board, isBlack)) {
+            board.unmakeMove(undo);
+            moves.setScore(i, -INFINITE_SCORE);
+            continue;
+        }
+        
+        // Calculate immediate score for this move
+        int immediateScore = calculateMoveScore(board, undo.captured, move.getTo());
+        m_playedMoves[0] = move;
+
+        // The search values positions by their evaluation, which includes what this move
+        // captured; that is already in the immediate score, everything else is future score
+        int evaluation = rootEvaluation + getPieceValue(undo.captured) * MATERIAL_WEIGHT;
+
+        // The future score has to beat this bound for the move to be recommended
+        std::span<const PossibleMovement> recommended = bestMoves.getQueue();
+        int lowerBound = -INFINITE_SCORE;
+        if (recommended.size() == PriorityQueue<PossibleMovement>::CAPACITY) {
+            lowerBound = recommended.back().getScore() - immediateScore;
+        }
+
+        // Calculate future score through the alpha-beta search
+        int futureScore = 0;
+        m_pvLength[1] = 0;
+        if (depth > 0) {
+            int searchBound = lowerBound > -INFINITE_SCORE ? lowerBound + evaluation : lowerBound;
+            futureScore = searchRootMove(board, depth, searchBound) - evaluation;
+        }
+
+        board.unmakeMove(undo);
+
+        // Final score is immediate + future, kept with the move in the list
+        int finalScore = immediateScore + futureScore;
+        moves.setScore(i, finalScore);
+
+        // A move that failed low cannot displace any recommendation
+        if (depth > 0 && futureScore <= lowerBound) {
+            continue;
+        }
+        updatePrincipalVariation(0, move);
+
+        // Create movement object and add to priority queue
+        PossibleMovement movement;
+        movement.setMove(move);
+        movement.setScore(finalScore);
+        movement.setLine({ m_pvTable[0].data(), static_cast<std::size_t>(m_pvLength[0]) });
+        bestMoves.push(movement);
+    }
+}
+
+
+/**
+ * Searches the position after a root move and returns its value for the root side.
+ * The first search uses a narrow aspiration window around the value this position had
+ * in an earlier search, or a null window on the bound when there is no such value;
+ * a side that the result falls outside of is opened and the position searched again.
+ *
+ * @param board The board after the root move.
+ * @param depth The search depth below the root.
+ * @param lowerBound The value the move has to beat to be recommended.
+ * @return The value of the move, exact when it lies above the lower bound.
+ */
+int PossibleMoves::searchRootMove(Board& board, int depth, int lowerBound) {
+
+    int low = lowerBound;
+    int high = INFINITE_SCORE;
+
+    TranspositionEntry entry;
+    if (m_table->probe(board.getHash(), entry) && entry.getBound() == BoundType::Exact) {
+        int guess = -scoreFromTable(entry.score, 1);
+        low = std::max(lowerBound, guess - ASPIRATION_WINDOW);
+        high = guess + ASPIRATION_WINDOW;
+    }
+    if (high <= low + 1 || (high == INFINITE_SCORE && lowerBound > -INFINITE_SCORE)) {
+        high = low + 1;
+    }
+
+    while (true) {
+        int score = -alphaBeta(board, 1, depth - 1, -high, -low);
+
+        if (isStopped()) {
+            return score;
+        }
+        if (score <= low && low > lowerBound) {
+            low = lowerBound;
+        }
+        else if (score >= high && high < INFINITE_SCORE) {
+            high = INFINITE_SCORE;
+        }
+        else {
+            return score;
         }
     }
 }
 
 
 /**
- * Implements the minimax algorithm to evaluate future move consequences.
+ * Negamax alpha-beta search with principal variation search: the first legal move is
+ * searched with the full window, later moves with a null window that only proves they
+ * are no better, and are searched again with the full window when they are.
+ * At the horizon the position is settled by a quiescence search.
+ * Away from the principal variation the search is selective, as far as m_options allows:
+ * near the horizon, positions far from the window are cut by their static evaluation
+ * (reverse futility, razoring) and quiet moves that can't reach alpha are skipped
+ * (futility); a null move that still fails high proves a cutoff with a shallow search;
+ * late quiet moves are searched shallower first and again at full depth if they
+ * turn out better than expected.
  *
  * @param board The board state to evaluate.
- * @param isBlackTurn True if it's black's turn, false for white.
- * @param depth Current depth in the search tree.
- * @param maxDepth Maximum depth to search.
- * @return The best score achievable from this position.
+ * @param ply The distance from the root.
+ * @param depth The remaining depth; 0 hands the position to the quiescence search.
+ * @param alpha The score the side to move is already guaranteed.
+ * @param beta The score above which the opponent avoids this position.
+ * @return The value of the position for the side to move; a fail-low returns at most
+ *         alpha and a fail-high at least beta. Meaningless once the search is stopped.
  */
-int PossibleMoves::minMax(Board& board, bool isBlackTurn, int depth, int maxDepth) {
+int PossibleMoves::alphaBeta(Board& board, int ply, int depth, int alpha, int beta) {
 
-    if (depth > maxDepth) {
+    m_pvLength[ply] = 0;
+    if (++m_nodes % NODE_CHECK_INTERVAL == 0 && isBudgetUsed(1)) {
+        stop();
+    }
+    if (isStopped()) {
         return 0;
     }
+    if (depth == 0) {
+        return quiescence(board, ply, 0, alpha, beta);
+    }
+    int originalAlpha = alpha;
+    bool isPvNode = beta - alpha > 1;
 
-    int bestScore = (isBlackTurn == m_recommendForBlack) ? INT_MIN : INT_MAX;
+    // Reuse a result for this position if it was searched at least as deep,
+    // possibly reached through a different move order. Not on the principal variation:
+    // the stored result has no line to go with it, and the expected line would end here
+    TranspositionEntry entry;
+    Move hashMove;
+    if (m_table->probe(board.getHash(), entry)) {
+        hashMove = entry.bestMove;
 
-    for (const auto& [pos, piece] : board.getBoard()) {
-        if (piece && piece->isBlack() == isBlackTurn) {
-            for (const std::string& target : allPositionsOnBoard()) {
-                if (target == pos) continue;
+        int score = scoreFromTable(entry.score, ply);
+        BoundType bound = entry.getBound();
+        bool isUsable = bound == BoundType::Exact || (bound == BoundType::Lower && score >= beta) || (bound == BoundType::Upper && score <= alpha);
+        if (!isPvNode && entry.depth >= depth && isUsable) {
+            return score;
+        }
+    }
 
-                auto targetPiece = board.getPieceAt(target);
-                if (targetPiece && (targetPiece->isBlack() == isBlackTurn)) continue;
+    bool isBlackTurn = board.isBlackTurn();
+    bool isInCheck = isKingExposed(board, isBlackTurn);
+    bool isSelective = !isPvNode && !isInCheck && !isMateScore(alpha) && !isMateScore(beta);
+    int staticEval = isSelective ? evaluate(board) : 0;
+
+    // Reverse futility: a position this far above beta won't fall below it in a few moves
+    if (isSelective && m_options.reverseFutility && depth <= REVERSE_FUTILITY_DEPTH
+        && staticEval - REVERSE_FUTILITY_MARGIN * depth >= beta) {
+        return staticEval;
+    }
+
+    // Razoring: a position this far below alpha only has captures left to try
+    if (isSelective && m_options.razoring && depth <= RAZORING_DEPTH
+        && staticEval + RAZORING_MARGIN * depth <= alpha) {
+        int score = quiescence(board, ply, 0, alpha, alpha + 1);
+        if (score <= alpha) {
+            return score;
+        }
+    }
 
-                if (!m_movementValidator.isMoveLegal(piece.get(), target, board.getBoard())) continue;
+    // Null move: if passing the turn still fails high, a real move will too. Not tried
+    // twice in a row, nor with only pawns left, where passing would be the best move
+    bool isAfterNullMove = m_playedMoves[ply - 1].isNull();
+    if (isSelective && m_options.nullMove && !m_isVerifyingNullMove && !isAfterNullMove
+        && depth >= NULL_MOVE_MIN_DEPTH && staticEval >= beta && !hasOnlyPawns(board, isBlackTurn)) {
 
-                // Simulate move
-                Board clonedBoard(board);
-                Piece* clonedPiece = clonedBoard.getPieceAt(pos);
-                if (!clonedPiece) continue;
+        int reducedDepth = std::max(0, depth - 1 - NULL_MOVE_REDUCTION - depth / 4);
+        board.makeNullMove();
+        m_playedMoves[ply] = Move();
+        int score = -alphaBeta(board, ply + 1, reducedDepth, -beta, -beta + 1);
+        board.unmakeNullMove();
 
-                Board beforeBoard(clonedBoard);
-                clonedBoard.movePiece(clonedPiece, target);
+        if (isStopped()) {
+            return 0;
+        }
+        if (score >= beta) {
+
+            // Near zugzwang the cutoff is only trusted once a reduced search of the real moves confirms it
+            Bitboard pawnsAndKing = board.getPieces(PieceType::Pawn, isBlackTurn) | board.getPieces(PieceType::King, isBlackTurn);
+            if (countSquares(board.getOccupancy(isBlackTurn) & ~pawnsAndKing) <= ZUGZWANG_PIECES) {
+                m_isVerifyingNullMove = true;
+                score = alphaBeta(board, ply, reducedDepth, beta - 1, beta);
+                m_isVerifyingNullMove = false;
+            }
+            if (score >= beta && !isStopped()) {
+                return isMateScore(score) ? beta : score;
+            }
+        }
+    }
+    bool isFutile = isSelective && m_options.futility && depth <= FUTILITY_DEPTH
+        && staticEval + FUTILITY_MARGIN * depth <= alpha;
 
-                int score;
-                if (depth == maxDepth) {
-                    
-                    score = calculateMoveScore(beforeBoard, clonedBoard, pos, target);
+    int bestScore = -INFINITE_SCORE;
+    Move bestMove;
 
-                    // Only negate if it's not the root player's turn
-                    if (isBlackTurn != m_recommendForBlack) {
-                        score = -score;
+    MoveList moves;
+    m_moveGenerator.generateMoves(board, isBlackTurn, moves);
+    orderMoves(board, moves, ply, hashMove);
+    int legalMoves = 0;
+
+    for (int i = 0; i < moves.size(); ++i) {
+        Move move = moves.pickBest(i);
+
+        // Simulate move, skipping moves that leave the king in check
+        UndoRecord undo = board.makeMove(move.getFrom(), move.getTo());
+        if (isKingExposed(board, isBlackTurn)) {
+            board.unmakeMove(undo);
+            continue;
+        }
+        ++legalMoves;
+
+        int score = searchMove(board, ply, depth, alpha, beta, move, legalMoves, isInCheck, isFutile);
+        board.unmakeMove(undo);
+        if (score == PRUNED_SCORE) {
+            continue;
+        }
+
+        // the result of an interrupted search is meaningless, don't store it
+        if (isStopped()) {
+            return 0;
+        }
+
+        if (score > bestScore) {
+            bestScore = score;
+            bestMove = move;
+
+            if (score > alpha) {
+                alpha = score;
+                updatePrincipalVariation(ply, move);
+
+                if (alpha >= beta) {
+                    if (!move.isCapture()) {
+                        recordQuietCutoff(isBlackTurn, ply, depth, move);
                     }
+                    break;
                 }
-                else {
-                    score = minMax(clonedBoard, !isBlackTurn, depth + 1, maxDepth);
-                }
+            }
+        }
 
-                if (isBlackTurn == m_recommendForBlack) {
-                    bestScore = std::max(bestScore, score);
-                }
-                else {
-                    bestScore = std::min(bestScore, score);
+        // Young brothers wait: once the first move has set a bound, the later moves
+        // may be searched by other threads
+        if (legalMoves == 1 && i + 1 < moves.size() && canSplit(depth)) {
+            SplitPoint& splitPoint = (*m_splitPoints)[ply];
+            splitPoint.board = board;
+            splitPoint.moves = moves;
+            splitPoint.ply = ply;
+            splitPoint.depth = depth;
+            splitPoint.beta = beta;
+            splitPoint.isInCheck = isInCheck;
+            splitPoint.isFutile = isFutile;
+            splitPoint.alpha = alpha;
+            splitPoint.legalMoves = legalMoves;
+            splitPoint.bestScore = bestScore;
+            splitPoint.bestMove = bestMove;
+            std::copy_n(m_pvTable[ply].begin(), m_pvLength[ply], splitPoint.line.begin());
+            splitPoint.lineLength = m_pvLength[ply];
+
+            searchSplitPoint(splitPoint, i + 1);
+            if (isStopped()) {
+                return 0;
+            }
+
+            legalMoves = splitPoint.legalMoves;
+            bestScore = splitPoint.bestScore;
+            bestMove = splitPoint.bestMove;
+            std::copy_n(splitPoint.line.begin(), splitPoint.lineLength, m_pvTable[ply].begin());
+            m_pvLength[ply] = splitPoint.lineLength;
+            if (bestScore >= beta && !bestMove.isCapture()) {
+                recordQuietCutoff(isBlackTurn, ply, depth, bestMove);
+            }
+            break;
+        }
+    }
+
+    if (legalMoves == 0) {
+
+        // checkmate if the king is attacked, otherwise stalemate; nearer mates score higher
+        bestScore = isKingExposed(board, isBlackTurn) ? -CHECKMATE_SCORE + ply : 0;
+    }
+
+    BoundType bound = BoundType::Exact;
+    if (bestScore <= originalAlpha) {
+        bound = BoundType::Upper;
+    }
+    else if (bestScore >= beta) {
+        bound = BoundType::Lower;
+    }
+    m_table->store(board.getHash(), depth, scoreToTable(bestScore, ply), bound, bestMove);
+    return bestScore;
+}
+
+
+/**
+ * Searches one legal move of a node after it was made on the board. A quiet move late
+ * in the list may be skipped by futility pruning or searched shallower first; every
+ * move but the first is tried with a null window before a full one.
+ *
+ * @param board The board after the move.
+ * @param ply The distance from the root of the node the move was made in.
+ * @param depth The remaining depth of that node.
+ * @param alpha The score the side to move is already guaranteed.
+ * @param beta The score above which the opponent avoids the node.
+ * @param move The move being searched.
+ * @param moveNumber The position of the move among the node's legal moves, from 1.
+ * @param isInCheck True if the side that made the move was in check before it.
+ * @param isFutile True if quiet moves of the node can't reach alpha.
+ * @return The value of the move for the side that made it, or PRUNED_SCORE if it was skipped.
+ */
+int PossibleMoves::searchMove(Board& board, int ply, int depth, int alpha, int beta, Move move, int moveNumber, bool isInCheck, bool isFutile) {
+
+    m_playedMoves[ply] = move;
+    bool isBlack = !board.isBlackTurn();
+
+    // Quiet moves that give check are neither pruned nor reduced
+    bool isQuiet = !move.isCapture() && !isInCheck && !isKingExposed(board, !isBlack);
+    if (isFutile && isQuiet && moveNumber > 1) {
+        return PRUNED_SCORE;
+    }
+
+    if (moveNumber == 1) {
+        return -alphaBeta(board, ply + 1, depth - 1, -beta, -alpha);
+    }
+
+    int reduction = 0;
+    if (m_options.lateMoveReductions && isQuiet && depth >= LMR_MIN_DEPTH && moveNumber > LMR_FULL_MOVES) {
+        reduction = getLateMoveReduction(isBlack, depth, moveNumber, move);
+    }
+
+    int score = -alphaBeta(board, ply + 1, depth - 1 - reduction, -alpha - 1, -alpha);
+    if (score > alpha && reduction > 0) {
+        score = -alphaBeta(board, ply + 1, depth - 1, -alpha - 1, -alpha);
+    }
+    if (score > alpha && score < beta) {
+        score = -alphaBeta(board, ply + 1, depth - 1, -beta, -alpha);
+    }
+    return score;
+}
+
+
+/**
+ * Checks whether the later moves of a node may be shared with other threads.
+ *
+ * @param depth The remaining depth of the node.
+ * @return True in work-stealing mode with helper threads, for nodes deep enough to be worth it.
+ */
+bool PossibleMoves::canSplit(int depth) const {
+
+    return m_parallelMode == ParallelMode::WorkStealing && !m_owner->m_helpers.empty()
+        && depth >= SPLIT_MIN_DEPTH && !m_isVerifyingNullMove;
+}
+
+
+/**
+ * Shares the moves of a split point from the given one on with the other threads and
+ * returns once all of them are searched. The moves are published on this thread's
+ * deque, best last, so this thread takes them in order while idle threads steal the
+ * later ones. When no move is left to take, it waits for the thieves to finish.
+ *
+ * @param splitPoint The split point, filled in with the node and its result so far.
+ * @param firstMove The index of the first move to share.
+ */
+void PossibleMoves::searchSplitPoint(SplitPoint& splitPoint, int firstMove) {
+
+    for (int i = firstMove; i < splitPoint.moves.size(); ++i) {
+        splitPoint.moves.pickBest(i);
+    }
+    splitPoint.parent = m_splitPoint;
+    splitPoint.isAborted = false;
+    splitPoint.pendingMoves = splitPoint.moves.size() - firstMove;
+
+    for (int i = splitPoint.moves.size() - 1; i >= firstMove; --i) {
+        SplitTask task = static_cast<SplitTask>(m_threadIndex) << TASK_THREAD_SHIFT
+            | static_cast<SplitTask>(splitPoint.ply) << TASK_PLY_SHIFT | static_cast<SplitTask>(i);
+        if (!m_tasks.push(task)) {
+            runTask(task);
+        }
+    }
+
+    // The moves of nested split points are all finished before their owner returns,
+    // so only moves of this split point can be left on the deque
+    SplitTask task;
+    while (splitPoint.pendingMoves.load(std::memory_order_acquire) > 0) {
+        if (m_tasks.pop(task)) {
+            runTask(task);
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+
+/**
+ * Searches one move of a split point on a copy of its position and merges the result
+ * into the split point. A result that reaches beta aborts the remaining moves.
+ *
+ * @param splitPoint The split point the move belongs to.
+ * @param moveIndex The index of the move in the split point's list.
+ */
+void PossibleMoves::searchSplitMove(SplitPoint& splitPoint, int moveIndex) {
+
+    Board board(splitPoint.board);
+    Move move = splitPoint.moves[moveIndex];
+    bool isBlack = board.isBlackTurn();
+
+    board.makeMove(move.getFrom(), move.getTo());
+    if (isKingExposed(board, isBlack)) {
+        return;
+    }
+    int moveNumber = ++splitPoint.legalMoves;
+
+    int alpha = splitPoint.alpha.load(std::memory_order_relaxed);
+    int score = searchMove(board, splitPoint.ply, splitPoint.depth, alpha, splitPoint.beta, move, moveNumber, splitPoint.isInCheck, splitPoint.isFutile);
+    if (score == PRUNED_SCORE || isStopped()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(splitPoint.resultMutex);
+    if (score > splitPoint.bestScore) {
+        splitPoint.bestScore = score;
+        splitPoint.bestMove = move;
+
+        if (score > splitPoint.alpha.load(std::memory_order_relaxed)) {
+            splitPoint.alpha.store(score, std::memory_order_relaxed);
+            splitPoint.line[0] = move;
+            std::copy_n(m_pvTable[splitPoint.ply + 1].begin(), m_pvLength[splitPoint.ply + 1], splitPoint.line.begin() + 1);
+            splitPoint.lineLength = m_pvLength[splitPoint.ply + 1] + 1;
+
+            if (score >= splitPoint.beta) {
+                splitPoint.isAborted.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+
+/**
+ * Searches a split point move taken from a deque, then marks it as finished.
+ * Moves of aborted split points are only marked.
+ *
+ * @param task The move, as pushed by the split point's owner.
+ */
+void PossibleMoves::runTask(SplitTask task) {
+
+    PossibleMoves& owner = getThread(static_cast<int>(task >> TASK_THREAD_SHIFT));
+    SplitPoint& splitPoint = (*owner.m_splitPoints)[(task >> TASK_PLY_SHIFT) & TASK_FIELD_MASK];
+
+    const SplitPoint* previous = m_splitPoint;
+    m_splitPoint = &splitPoint;
+    if (!isStopped()) {
+        searchSplitMove(splitPoint, static_cast<int>(task & TASK_MOVE_MASK));
+    }
+    m_splitPoint = previous;
+
+    splitPoint.pendingMoves.fetch_sub(1, std::memory_order_release);
+}
+
+
+/**
+ * Work loop of a helper thread in work-stealing mode: steals split point moves from
+ * the other threads' deques until the owner's search is done.
+ */
+void PossibleMoves::stealUntilSearchDone() {
+
+    int threadCount = static_cast<int>(m_owner->m_helpers.size()) + 1;
+    int victim = m_threadIndex;
+
+    while (!m_owner->m_isSearchDone.load(std::memory_order_acquire)) {
+        bool isStolen = false;
+        SplitTask task;
+
+        for (int i = 1; i < threadCount && !isStolen; ++i) {
+            victim = (victim + 1) % threadCount;
+            if (victim != m_threadIndex) {
+                isStolen = getThread(victim).m_tasks.steal(task);
+            }
+        }
+
+        if (isStolen) {
+            runTask(task);
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+
+/**
+ * Returns the searcher of one of the threads working on the owner's search.
+ *
+ * @param threadIndex 0 for the owner, 1 + helper index for a helper.
+ * @return The thread's searcher.
+ */
+PossibleMoves& PossibleMoves::getThread(int threadIndex) {
+    return threadIndex == 0 ? *m_owner : *m_owner->m_helpers[threadIndex - 1];
+}
+
+
+/**
+ * Chooses how many plies shallower a late quiet move is searched first: one, another
+ * for moves far down the list or deep in the tree, one less for moves whose history
+ * shows they often caused cutoffs. The move is always searched at least one ply deep.
+ *
+ * @param isBlack The color of the side playing the move.
+ * @param depth The remaining depth before the move.
+ * @param moveNumber The position of the move among the legal moves tried, from 1.
+ * @param move The move to reduce.
+ * @return The reduction in plies.
+ */
+int PossibleMoves::getLateMoveReduction(bool isBlack, int depth, int moveNumber, Move move) const {
+
+    int reduction = 1;
+    if (moveNumber > LMR_LATE_MOVES) {
+        ++reduction;
+    }
+    if (depth >= 2 * LMR_MIN_DEPTH) {
+        ++reduction;
+    }
+    if (m_history[isBlack][move.getFrom()][move.getTo()] >= LMR_GOOD_HISTORY) {
+        --reduction;
+    }
+    return std::clamp(reduction, 0, depth - 2);
+}
+
+
+/**
+ * Searches only captures until the position is quiet, so a half-finished exchange at
+ * the horizon is not mistaken for a win. The side to move may "stand pat" on the
+ * static evaluation instead of capturing; captures that cannot lift the evaluation
+ * to alpha even with a margin are skipped (delta pruning). A side in check must
+ * answer it, so all its moves are searched and having none is checkmate.
+ *
+ * @param board The board state to evaluate.
+ * @param ply The distance from the root.
+ * @param quiescenceDepth The number of captures already searched past the horizon.
+ * @param alpha The score the side to move is already guaranteed.
+ * @param beta The score above which the opponent avoids this position.
+ * @return The value of the position for the side to move, within the same bounds as alphaBeta.
+ */
+int PossibleMoves::quiescence(Board& board, int ply, int quiescenceDepth, int alpha, int beta) {
+
+    m_pvLength[ply] = 0;
+    if (++m_nodes % NODE_CHECK_INTERVAL == 0 && isBudgetUsed(1)) {
+        stop();
+    }
+    if (isStopped()) {
+        return 0;
+    }
+
+    bool isBlackTurn = board.isBlackTurn();
+    bool isInCheck = isKingExposed(board, isBlackTurn);
+    int standPat = evaluate(board);
+
+    if (ply >= MAX_PLY - 1 || quiescenceDepth >= MAX_QUIESCENCE_DEPTH) {
+        return standPat;
+    }
+
+    int bestScore = -INFINITE_SCORE;
+    if (!isInCheck) {
+        if (standPat >= beta) {
+            return standPat;
+        }
+        alpha = std::max(alpha, standPat);
+        bestScore = standPat;
+    }
+
+    MoveList moves;
+    if (isInCheck) {
+        m_moveGenerator.generateMoves(board, isBlackTurn, moves);
+    }
+    else {
+        m_moveGenerator.generateCaptures(board, isBlackTurn, moves);
+    }
+    orderMoves(board, moves, ply, Move());
+    int legalMoves = 0;
+
+    for (int i = 0; i < moves.size(); ++i) {
+        Move move = moves.pickBest(i);
+
+        if (!isInCheck) {
+            int gain = getPieceValue(board.getPieceAt(move.getTo())) * MATERIAL_WEIGHT;
+            if (standPat + gain + DELTA_MARGIN <= alpha) {
+                continue;
+            }
+        }
+
+        // Simulate move, skipping moves that leave the king in check
+        UndoRecord undo = board.makeMove(move.getFrom(), move.getTo());
+        if (isKingExposed(board, isBlackTurn)) {
+            board.unmakeMove(undo);
+            continue;
+        }
+        ++legalMoves;
+        m_playedMoves[ply] = move;
+
+        int score = -quiescence(board, ply + 1, quiescenceDepth + 1, -beta, -alpha);
+        board.unmakeMove(undo);
+
+        if (isStopped()) {
+            return 0;
+        }
+
+        if (score > bestScore) {
+            bestScore = score;
+
+            if (score > alpha) {
+                alpha = score;
+                updatePrincipalVariation(ply, move);
+
+                if (alpha >= beta) {
+                    break;
                 }
+            }
+        }
+    }
+
+    if (isInCheck && legalMoves == 0) {
+        return -CHECKMATE_SCORE + ply;
+    }
+    return bestScore;
+}
+
+
+/**
+ * Evaluates a position by material and piece placement, tapered by the game phase.
+ * The board keeps these sums up to date as pieces move, so this takes constant time.
+ *
+ * @param board The board state to evaluate.
+ * @return The evaluation from the point of view of the side to move.
+ */
+int PossibleMoves::evaluate(const Board& board) const {
+
+    int score = board.getEvaluation() * MATERIAL_WEIGHT;
+    return board.isBlackTurn() ? -score : score;
+}
+
+
+/**
+ * Scores moves for the order they are tried in: the stored best move first, then
+ * captures by most valuable victim and least valuable attacker, the two killer moves
+ * of this ply, the counter move to the opponent's last move, and other quiet moves
+ * by how often they caused cutoffs before.
+ *
+ * @param board The board before the moves.
+ * @param moves The moves to score.
+ * @param ply The distance from the root.
+ * @param hashMove The best move stored for the position, or a null move.
+ */
+void PossibleMoves::orderMoves(const Board& board, MoveList& moves, int ply, Move hashMove) const {
+
+    bool isBlack = board.isBlackTurn();
+    Move counterMove;
+    if (ply > 0) {
+        Move previous = m_playedMoves[ply - 1];
+        counterMove = m_counterMoves[previous.getFrom()][previous.getTo()];
+    }
+
+    for (int i = 0; i < moves.size(); ++i) {
+        Move move = moves[i];
+        int score;
+
+        if (move == hashMove) {
+            score = HASH_MOVE_ORDER;
+        }
+        else if (move.isCapture()) {
+            int victimValue = getPieceValue(board.getPieceAt(move.getTo()));
+            int attackerValue = getPieceValue(board.getPieceAt(move.getFrom()));
+            score = CAPTURE_ORDER + victimValue * VICTIM_ORDER_WEIGHT - attackerValue;
+        }
+        else if (move == m_killers[ply][0]) {
+            score = FIRST_KILLER_ORDER;
+        }
+        else if (move == m_killers[ply][1]) {
+            score = SECOND_KILLER_ORDER;
+        }
+        else if (move == counterMove) {
+            score = COUNTER_MOVE_ORDER;
+        }
+        else {
+            score = m_history[isBlack][move.getFrom()][move.getTo()];
+        }
+        moves.setScore(i, score);
+    }
+}
 
-                bestScore = std::max(bestScore, score);
 
+/**
+ * Remembers a quiet move that caused a beta cutoff: as a killer move of its ply,
+ * as the counter move to the opponent's last move, and in the history table with
+ * a bonus that grows with the depth of the cutoff.
+ *
+ * @param isBlack The color of the side that played the move.
+ * @param ply The distance from the root.
+ * @param depth The remaining depth at the cutoff.
+ * @param move The move that caused the cutoff.
+ */
+void PossibleMoves::recordQuietCutoff(bool isBlack, int ply, int depth, Move move) {
+
+    if (move != m_killers[ply][0]) {
+        m_killers[ply][1] = m_killers[ply][0];
+        m_killers[ply][0] = move;
+    }
+
+    Move previous = ply > 0 ? m_playedMoves[ply - 1] : Move();
+    if (!previous.isNull()) {
+        m_counterMoves[previous.getFrom()][previous.getTo()] = move;
+    }
+
+    int& history = m_history[isBlack][move.getFrom()][move.getTo()];
+    history += (depth + 1) * (depth + 1);
+    if (history > HISTORY_LIMIT) {
+        ageHistory();
+    }
+}
+
+
+/**
+ * Halves every history score, so recent cutoffs weigh more than old ones.
+ */
+void PossibleMoves::ageHistory() {
+
+    for (auto& fromTable : m_history) {
+        for (auto& toTable : fromTable) {
+            for (int& score : toTable) {
+                score /= 2;
             }
         }
     }
+}
 
-    return (bestScore == INT_MIN || bestScore == INT_MAX) ? 0 : bestScore;
 
+/**
+ * Prepares the move ordering tables for a new search. Killer moves belong to the
+ * positions of one search and are cleared; history and counter moves carry over,
+ * with history aged so the new search's cutoffs soon dominate.
+ */
+void PossibleMoves::resetMoveOrdering() {
+
+    for (auto& killers : m_killers) {
+        killers = { Move(), Move() };
+    }
+    ageHistory();
 }
 
 
 /**
- * Generates all possible positions on a standard chess board.
+ * Checks whether the search was asked to stop or ran out of budget, or whether a
+ * cutoff made the split point move this thread is searching useless.
  *
- * @return A vector containing all 64 board positions in algebraic notation.
+ * @return True if the running search must unwind.
  */
-std::vector<std::string> PossibleMoves::allPositionsOnBoard() const {
+bool PossibleMoves::isStopped() const {
 
-    std::vector<std::string> positions;
+    if (m_stopFlag->load(std::memory_order_relaxed)) {
+        return true;
+    }
 
-    for (char row = 'a'; row <= 'h'; ++row) {
-        for (char col = '1'; col <= '8'; ++col) {
-            positions.push_back(std::string{ row, col });
+    // a cutoff at any split point this thread is working under makes its work useless
+    for (const SplitPoint* splitPoint = m_splitPoint; splitPoint != nullptr; splitPoint = splitPoint->parent) {
+        if (splitPoint->isAborted.load(std::memory_order_relaxed)) {
+            return true;
         }
     }
+    return false;
+}
+
+
+/**
+ * Checks whether a share of the time or node budget has been spent.
+ *
+ * @param divisor The share of the budget to test for, 1 for all of it, 2 for half...
+ * @return True if the share of either budget is spent, false if there is no budget.
+ */
+bool PossibleMoves::isBudgetUsed(int divisor) const {
 
-    return positions;
+    if (m_limits.nodes > 0 && m_nodes * divisor >= m_limits.nodes) {
+        return true;
+    }
+    if (m_limits.timeMs > 0) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_startTime);
+        return elapsed.count() * divisor >= m_limits.timeMs;
+    }
+    return false;
+}
+
+
+/**
+ * Records a move as the start of the best line found at a ply, followed by the best line
+ * found one ply deeper.
+ *
+ * @param ply The distance from the root.
+ * @param move The move that raised alpha at that ply.
+ */
+void PossibleMoves::updatePrincipalVariation(int ply, Move move) {
+
+    m_pvTable[ply][0] = move;
+    for (int i = 0; i < m_pvLength[ply + 1]; ++i) {
+        m_pvTable[ply][i + 1] = m_pvTable[ply + 1][i];
+    }
+    m_pvLength[ply] = m_pvLength[ply + 1] + 1;
+}
+
+
+/**
+ * Converts a score to the form stored in the transposition table. Mate scores count
+ * the distance from the root; in the table they count from the stored position instead,
+ * so the entry stays correct when the position is reached at another ply.
+ *
+ * @param score The score as returned by the search.
+ * @param ply The distance of the position from the root.
+ * @return The score to store.
+ */
+int PossibleMoves::scoreToTable(int score, int ply) const {
+
+    if (score > CHECKMATE_SCORE - MAX_PLY) return score + ply;
+    if (score < -CHECKMATE_SCORE + MAX_PLY) return score - ply;
+    return score;
+}
+
+
+/**
+ * Converts a score read from the transposition table back to a distance from the root.
+ *
+ * @param score The stored score.
+ * @param ply The distance of the position from the root.
+ * @return The score as used by the search.
+ */
+int PossibleMoves::scoreFromTable(int score, int ply) const {
+
+    if (score > CHECKMATE_SCORE - MAX_PLY) return score - ply;
+    if (score < -CHECKMATE_SCORE + MAX_PLY) return score + ply;
+    return score;
 }
 
 
@@ -0,0 +1,227 @@
+#include "ProposeMoves/TranspositionTable.h"
+
+const std::uint8_t BOUND_MASK = 0x03;	// Bound types are stored in the low 2 bits
+const std::uint8_t AGE_MASK = 0x3F;		// Ages are stored in the upper 6 bits
+const int AGE_WEIGHT = 8;				// Depth an entry loses per search generation it has aged
+
+
+/**
+ * Returns how the stored score relates to the true value.
+ *
+ * @return The bound type, BoundType::None for an empty entry.
+ */
+BoundType TranspositionEntry::getBound() const {
+	return static_cast<BoundType>(boundAndAge & BOUND_MASK);
+}
+
+
+/**
+ * Returns the search generation that wrote the entry.
+ *
+ * @return The entry's age.
+ */
+std::uint8_t TranspositionEntry::getAge() const {
+	return boundAndAge >> 2;
+}
+
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Constructs a table using about the given amount of memory.
+ *
+ * @param sizeInMB The table size in megabytes.
+ */
+TranspositionTable::TranspositionTable(std::size_t sizeInMB) {
+	resize(sizeInMB);
+}
+
+
+/**
+ * Reallocates the table to the largest power-of-two bucket count that fits
+ * in the given size. All stored entries are lost.
+ *
+ * @param sizeInMB The table size in megabytes.
+ */
+void TranspositionTable::resize(std::size_t sizeInMB) {
+
+	std::size_t maxBuckets = sizeInMB * 1024 * 1024 / sizeof(Bucket);
+	std::size_t bucketCount = 1;
+	while (bucketCount * 2 <= maxBuckets) {
+		bucketCount *= 2;
+	}
+
+	m_buckets = std::make_unique<Bucket[]>(bucketCount);
+	m_mask = bucketCount - 1;
+	m_age = 0;
+}
+
+
+/**
+ * Empties all entries without changing the table size.
+ */
+void TranspositionTable::clear() {
+
+	for (std::uint64_t i = 0; i <= m_mask; ++i) {
+		for (Slot& slot : m_buckets[i].slots) {
+			writeSlot(slot, TranspositionEntry{});
+		}
+	}
+	m_age = 0;
+}
+
+
+/**
+ * Starts a new search generation, so entries from older searches are replaced first.
+ */
+void TranspositionTable::newSearch() {
+	m_age = (m_age + 1) & AGE_MASK;
+}
+
+
+/**
+ * Looks up a position in the table.
+ *
+ * @param key The Zobrist key of the position.
+ * @param entry Receives a copy of the stored entry when found.
+ * @return True if the position is stored in the table.
+ */
+bool TranspositionTable::probe(std::uint64_t key, TranspositionEntry& entry) const {
+
+	for (const Slot& slot : bucketFor(key).slots) {
+		TranspositionEntry candidate = readSlot(slot);
+		if (candidate.getBound() != BoundType::None && candidate.key == key) {
+			entry = candidate;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/**
+ * Stores a search result. An entry for the same position is updated in place;
+ * otherwise the entry with the lowest depth, adjusted for its age, is replaced.
+ *
+ * @param key The Zobrist key of the position.
+ * @param depth The remaining depth the position was searched to.
+ * @param score The score from the point of view of the side to move.
+ * @param bound How the score relates to the true value.
+ * @param bestMove The best move found, or a null move if none.
+ */
+void TranspositionTable::store(std::uint64_t key, int depth, int score, BoundType bound, Move bestMove) {
+
+	Bucket& bucket = bucketFor(key);
+	Slot* targetSlot = &bucket.slots[0];
+	TranspositionEntry target = readSlot(*targetSlot);
+
+	for (Slot& slot : bucket.slots) {
+		TranspositionEntry candidate = readSlot(slot);
+		if (candidate.getBound() != BoundType::None && candidate.key == key) {
+
+			// keep a deeper result for the same position unless the new one is exact
+			if (depth < candidate.depth && bound != BoundType::Exact && candidate.getAge() == m_age) {
+				return;
+			}
+			targetSlot = &slot;
+			target = candidate;
+			break;
+		}
+		if (replacementPriority(candidate) < replacementPriority(target)) {
+			targetSlot = &slot;
+			target = candidate;
+		}
+	}
+
+	// keep the previous best move when this result has none
+	if (!bestMove.isNull() || target.key != key) {
+		target.bestMove = bestMove;
+	}
+
+	target.key = key;
+	target.score = score;
+	target.depth = static_cast<std::int8_t>(depth);
+	target.boundAndAge = static_cast<std::uint8_t>(static_cast<std::uint8_t>(bound) | (m_age << 2));
+	writeSlot(*targetSlot, target);
+}
+
+
+/**
+ * Selects the bucket a key belongs to.
+ *
+ * @param key The Zobrist key of the position.
+ * @return The bucket that may hold the position.
+ */
+TranspositionTable::Bucket& TranspositionTable::bucketFor(std::uint64_t key) {
+	return m_buckets[key & m_mask];
+}
+
+
+/**
+ * Selects the bucket a key belongs to.
+ *
+ * @param key The Zobrist key of the position.
+ * @return The bucket that may hold the position.
+ */
+const TranspositionTable::Bucket& TranspositionTable::bucketFor(std::uint64_t key) const {
+	return m_buckets[key & m_mask];
+}
+
+
+/**
+ * Rates how valuable it is to keep an entry: empty entries are the first to go,
+ * then shallow ones, with every search generation of age costing some depth.
+ *
+ * @param entry The entry to rate.
+ * @return A priority, lower values are replaced first.
+ */
+int TranspositionTable::replacementPriority(const TranspositionEntry& entry) const {
+
+	if (entry.getBound() == BoundType::None) {
+		return INT32_MIN;
+	}
+
+	int ageDistance = (m_age - entry.getAge()) & AGE_MASK;
+	return entry.depth - ageDistance * AGE_WEIGHT;
+}
+
+
+/**
+ * Unpacks an entry. The key is recovered from the check word, so an entry whose two
+ * words were written by different stores yields a key no search asks for.
+ *
+ * @param slot The slot to read.
+ * @return The entry held by the slot, with BoundType::None if empty.
+ */
+TranspositionEntry TranspositionTable::readSlot(const Slot& slot) {
+
+	std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+	std::uint64_t check = slot.check.load(std::memory_order_relaxed);
+
+	TranspositionEntry entry;
+	entry.key = check ^ data;
+	entry.score = static_cast<std::int32_t>(static_cast<std::uint32_t>(data));
+	entry.bestMove = Move::fromData(static_cast<std::uint16_t>(data >> 32));
+	entry.depth = static_cast<std::int8_t>(data >> 48);
+	entry.boundAndAge = static_cast<std::uint8_t>(data >> 56);
+	return entry;
+}
+
+
+/**
+ * Packs an entry into a slot: the score in the low 32 bits of the data word,
+ * then the best move, the depth and the bound and age.
+ *
+ * @param slot The slot to overwrite.
+ * @param entry The entry to store.
+ */
+void TranspositionTable::writeSlot(Slot& slot, const TranspositionEntry& entry) {
+
+	std::uint64_t data = static_cast<std::uint32_t>(entry.score)
+		| static_cast<std::uint64_t>(entry.bestMove.getData()) << 32
+		| static_cast<std::uint64_t>(static_cast<std::uint8_t>(entry.depth)) << 48
+		| static_cast<std::uint64_t>(entry.boundAndAge) << 56;
+
+	slot.data.store(data, std::memory_order_relaxed);
+	slot.check.store(entry.key ^ data, std::memory_order_relaxed);
+}
@@ -2,13 +2,55 @@
 #include "Chess.h"
 #include "GameController.h"
 #include <iostream>
+#include <cstdint>
+#include <cstdlib>
 #include <Exceptions/StringFormatException.h>
 #include <Exceptions/EmptyQueueException.h>
 
-int main()
+int main(int argc, char* argv[])
 {
 	string board = "RNBQKBNRPPPPPPPP################################pppppppprnbqkbnr"; 
 
+	// optional search budgets per recommendation: --movetime <milliseconds>, --nodes <count>
+	// selective techniques can be switched off: --disable nullmove|lmr|futility|rfp|razoring
+	// searches can use several threads: --threads <count>, dividing work by --parallel root|lazy|steal
+	// the next recommendations can be searched while the player thinks: --ponder on
+	std::int64_t timeLimitMs = 0;
+	std::uint64_t nodeLimit = 0;
+	SearchOptions searchOptions;
+	int threadCount = 1;
+	ParallelMode parallelMode = ParallelMode::RootSplit;
+	bool isPonderingEnabled = false;
+	for (int i = 1; i + 1 < argc; i += 2) {
+		std::string option = argv[i];
+		if (option == "--movetime") {
+			timeLimitMs = std::strtoll(argv[i + 1], nullptr, 10);
+		}
+		else if (option == "--nodes") {
+			nodeLimit = std::strtoull(argv[i + 1], nullptr, 10);
+		}
+		else if (option == "--threads") {
+			threadCount = std::atoi(argv[i + 1]);
+		}
+		else if (option == "--parallel") {
+			std::string mode = argv[i + 1];
+			if (mode == "root") parallelMode = ParallelMode::RootSplit;
+			else if (mode == "lazy") parallelMode = ParallelMode::LazySmp;
+			else if (mode == "steal") parallelMode = ParallelMode::WorkStealing;
+		}
+		else if (option == "--ponder") {
+			isPonderingEnabled = std::string(argv[i + 1]) == "on";
+		}
+		else if (option == "--disable") {
+			std::string technique = argv[i + 1];
+			if (technique == "nullmove") searchOptions.nullMove = false;
+			else if (technique == "lmr") searchOptions.lateMoveReductions = false;
+			else if (technique == "futility") searchOptions.futility = false;
+			else if (technique == "rfp") searchOptions.reverseFutility = false;
+			else if (technique == "razoring") searchOptions.razoring = false;
+		}
+	}
+
 	try {
 
 		Chess a(board);
@@ -18,12 +60,20 @@ int main()
 		std::cin >> wantedDepth;
 
 		GameController controller(board, wantedDepth);
+		controller.setTimeLimit(timeLimitMs);
+		controller.setNodeLimit(nodeLimit);
+		controller.setSearchOptions(searchOptions);
+		controller.setParallelMode(parallelMode);
+		controller.setThreadCount(threadCount);
+		controller.setPondering(isPonderingEnabled);
 
 		int codeResponse = 0;
 		auto moves = controller.recommendMoves();
 		std::string formatted = controller.formatRecommendations(moves);
 
+		controller.startPondering();
 		string res = a.getInput(formatted);
+		controller.stopPondering();
 		while (res != "exit")
 		{
 			/*
@@ -47,7 +97,9 @@ int main()
 				auto moves = controller.recommendMoves();
 				std::string formatted = controller.formatRecommendations(moves);
 				a.setCodeResponse(codeResponse);
+				controller.startPondering();
 				res = a.getInput(formatted);
+				controller.stopPondering();
 			}
 			catch (const EmptyQueueException& e) {
 				std::cerr << "Warning: " << e.what() << std::endl;
@@ -0,0 +1,36 @@
+﻿# Plays a few moves at a fixed search depth and checks that every recommendation comes
+# with an expected line at least that long. The moves keep mate and stalemate far away,
+# so no line may end early.
+#
+# CHESS   - path to the Chess executable
+# OPTIONS - its command line options, as a list
+# DEPTH   - the search depth to enter
+
+# one input file per test, the tests may run in parallel
+string (REPLACE ";" "_" inputSuffix "${OPTIONS}")
+set (input "${CMAKE_CURRENT_BINARY_DIR}/ExpectedLineLength${inputSuffix}.txt")
+file (WRITE ${input} "${DEPTH}\nb6c6\ng5e5\nc6d6\nexit\n")
+
+execute_process (COMMAND ${CHESS} ${OPTIONS}
+				 INPUT_FILE ${input}
+				 OUTPUT_VARIABLE output
+				 RESULT_VARIABLE result
+				 TIMEOUT 300)
+if (NOT result EQUAL 0)
+	message (FATAL_ERROR "Chess exited with ${result}")
+endif ()
+
+string (REGEX MATCHALL "line:( [a-h][1-8][a-h][1-8])+" lines "${output}")
+list (LENGTH lines lineCount)
+if (lineCount EQUAL 0)
+	message (FATAL_ERROR "No expected lines in the output:\n${output}")
+endif ()
+
+foreach (line IN LISTS lines)
+	string (REGEX MATCHALL "[a-h][1-8][a-h][1-8]" moves "${line}")
+	list (LENGTH moves moveCount)
+	if (moveCount LESS DEPTH)
+		message (FATAL_ERROR "Expected at least ${DEPTH} moves, got ${moveCount}: ${line}")
+	endif ()
+endforeach ()
+message (STATUS "${lineCount} lines of at least ${DEPTH} moves")